@@ -0,0 +1,217 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_anomaly.c
+ *
+ * @brief
+ *  Rolling z-score anomaly detector. Mean and variance are exponentially
+ *  weighted with a power of two coefficient, so each sample costs a few
+ *  shifts, additions and one 64 bit multiplication. The z test compares
+ *  squares, the square root is only taken when an event is reported.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_anomaly.h"
+#include "adc_stats.h"
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_anomaly_init
+
+ Function Description:
+ @brief    Validates the settings and resets the rolling statistics.
+
+ @param p_an         Detector to be initialized
+ @param shift        Rolling window of about 2^shift samples, 0 to disable
+ @param k_q8         z threshold, Q8
+ @param cooldown     Samples without events after an event
+ @param min_sigma    Smallest standard deviation, in sample units
+
+ @return 1 on success, 0 if the settings are not supported
+ */
+int adc_anomaly_init(adc_anomaly_t *p_an, uint8_t shift, uint16_t k_q8,
+                     uint16_t cooldown, uint16_t min_sigma)
+{
+    p_an->shift = 0;
+    p_an->events = 0;
+    p_an->suppressed = 0;
+    p_an->z_q8 = 0;
+    p_an->holdoff = 0;
+    p_an->mean_q8 = 0;
+    p_an->var_q16 = 0;
+
+    if (shift == 0)
+    {
+        return 1;
+    }
+    if ((shift > ADC_ANOMALY_MAX_SHIFT) || (k_q8 == 0) ||
+        (k_q8 > ADC_ANOMALY_MAX_K_Q8))
+    {
+        return 0;
+    }
+
+    p_an->shift = shift;
+    p_an->k2_q16 = (uint32_t)k_q8 * k_q8;
+    p_an->cooldown = cooldown;
+    p_an->var_floor_q16 = ((uint64_t)min_sigma * min_sigma) <<
+                          (2 * ADC_ANOMALY_FRAC_BITS);
+    /* One window to settle before testing */
+    p_an->warmup = (uint16_t)(1u << shift);
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_anomaly_check
+
+ Function Description:
+ @brief    Tests a sample against the statistics of the samples before
+           it, then updates the statistics with it. The first sample
+           seeds the mean.
+
+ @param p_an    Detector
+ @param x       Sample
+
+ @return 1 if the sample is an anomaly outside a cooldown, 0 otherwise
+ */
+int adc_anomaly_check(adc_anomaly_t *p_an, int16_t x)
+{
+    uint8_t shift = p_an->shift;
+    int32_t d;
+    uint64_t d2;
+    uint64_t var;
+    uint64_t limit;
+    int anomaly = 0;
+
+    if (shift == 0)
+    {
+        return 0;
+    }
+
+    /* First sample since init */
+    if (p_an->warmup == (1u << shift))
+    {
+        p_an->mean_q8 = (int32_t)x << ADC_ANOMALY_FRAC_BITS;
+    }
+
+    d = ((int32_t)x << ADC_ANOMALY_FRAC_BITS) - p_an->mean_q8;
+    d2 = (uint64_t)((int64_t)d * d);
+
+    if (p_an->holdoff != 0)
+    {
+        p_an->holdoff--;
+    }
+
+    if (p_an->warmup != 0)
+    {
+        p_an->warmup--;
+    }
+    else
+    {
+        var = (uint64_t)p_an->var_q16;
+        if (var < p_an->var_floor_q16)
+        {
+            var = p_an->var_floor_q16;
+        }
+
+        /* d^2 > k^2 var, with k^2 in Q16 split to stay within 64 bits */
+        limit = (var >> 16) * p_an->k2_q16 +
+                (((var & 0xFFFF) * p_an->k2_q16) >> 16);
+
+        if (d2 > limit)
+        {
+            if (p_an->holdoff != 0)
+            {
+                p_an->suppressed++;
+            }
+            else
+            {
+                uint32_t sigma_q8 = adc_isqrt64(var);
+
+                p_an->z_q8 = (uint32_t)((((uint64_t)(d < 0 ? -d : d)) <<
+                                         ADC_ANOMALY_FRAC_BITS) /
+                                        (sigma_q8 ? sigma_q8 : 1));
+                p_an->events++;
+                p_an->holdoff = p_an->cooldown;
+                anomaly = 1;
+            }
+        }
+    }
+
+    /* var = (1 - a)(var + a d^2), a = 1 / 2^shift */
+    p_an->mean_q8 += d >> shift;
+    p_an->var_q16 += (int64_t)((d2 - (d2 >> shift)) >> shift) -
+                     (p_an->var_q16 >> shift);
+
+    return anomaly;
+}
+
+/*
+ Function name:
+ adc_anomaly_mean_q8
+
+ Function Description:
+ @brief    Returns the rolling mean.
+
+ @param p_an    Detector
+
+ @return mean with ADC_ANOMALY_FRAC_BITS fraction
+ */
+int32_t adc_anomaly_mean_q8(const adc_anomaly_t *p_an)
+{
+    return p_an->mean_q8;
+}
+
+/*
+ Function name:
+ adc_anomaly_sigma_q8
+
+ Function Description:
+ @brief    Returns the rolling standard deviation.
+
+ @param p_an    Detector
+
+ @return standard deviation with ADC_ANOMALY_FRAC_BITS fraction
+ */
+uint32_t adc_anomaly_sigma_q8(const adc_anomaly_t *p_an)
+{
+    return adc_isqrt64((uint64_t)p_an->var_q16);
+}
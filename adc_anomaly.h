@@ -0,0 +1,96 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_anomaly.h
+ *
+ * @brief
+ *  Streaming anomaly detector. A sample is anomalous when it lies more
+ *  than k standard deviations from an exponentially weighted rolling
+ *  mean. Events are rate limited by a cooldown.
+ */
+
+#ifndef ADC_ANOMALY_H
+#define ADC_ANOMALY_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Fractional bits of the rolling mean, the variance has twice as many */
+#define ADC_ANOMALY_FRAC_BITS         8
+
+/* Largest rolling window shift */
+#define ADC_ANOMALY_MAX_SHIFT         12
+
+/* Largest z threshold, 16 standard deviations in Q8 */
+#define ADC_ANOMALY_MAX_K_Q8          4096
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    int32_t  mean_q8;                 /* Rolling mean */
+    int64_t  var_q16;                 /* Rolling variance */
+    uint64_t var_floor_q16;           /* Smallest variance used for the test */
+    uint32_t k2_q16;                  /* Squared z threshold */
+    uint32_t events;                  /* Anomalies reported */
+    uint32_t suppressed;              /* Anomalies inside a cooldown */
+    uint32_t z_q8;                    /* z of the last reported anomaly */
+    uint16_t cooldown;                /* Samples without events after one */
+    uint16_t holdoff;                 /* Samples left in the current cooldown */
+    uint16_t warmup;                  /* Samples left before testing starts */
+    uint8_t  shift;                   /* Window of about 2^shift samples, 0 disables */
+} adc_anomaly_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/*
+ * shift sets the rolling window, 0 disables the detector. k_q8 is the z
+ * threshold and min_sigma, in sample units, keeps a flat signal from
+ * flagging every count of noise. Returns 0 if the settings are invalid.
+ */
+int adc_anomaly_init(adc_anomaly_t *p_an, uint8_t shift, uint16_t k_q8,
+                     uint16_t cooldown, uint16_t min_sigma);
+
+/* Tests then learns a sample, returns 1 if it is a reported anomaly */
+int adc_anomaly_check(adc_anomaly_t *p_an, int16_t x);
+
+/* Rolling mean and standard deviation, ADC_ANOMALY_FRAC_BITS fraction */
+int32_t adc_anomaly_mean_q8(const adc_anomaly_t *p_an);
+uint32_t adc_anomaly_sigma_q8(const adc_anomaly_t *p_an);
+
+#endif /* ADC_ANOMALY_H */
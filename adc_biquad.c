@@ -0,0 +1,266 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_biquad.c
+ *
+ * @brief
+ *  Fixed-point biquad cascade. Products are 16x16 bit and accumulate in
+ *  64 bits, so a section can not overflow internally; only its output is
+ *  saturated to 16 bits.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include "adc_biquad.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define ADC_BIQUAD_ROUND              (1 << (ADC_BIQUAD_COEF_SHIFT - 1))
+
+/******************************************************************************
+ *                          Variables Definitions
+ ******************************************************************************/
+const adc_biquad_coef_t adc_biquad_lp2_fs20[1] =
+{
+    { 329, 658, 329, -25576, 10508 },
+};
+
+const adc_biquad_coef_t adc_biquad_lp2_fs10[1] =
+{
+    { 1105, 2210, 1105, -18727, 6763 },
+};
+
+const adc_biquad_coef_t adc_biquad_lp4_fs20[2] =
+{
+    { 312, 624, 312, -24243, 9107 },
+    { 359, 717, 359, -27869, 12919 },
+};
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+static int16_t adc_biquad_saturate(int64_t val);
+
+static void adc_biquad_df1(const adc_biquad_coef_t *p_coef,
+                           adc_biquad_state_t *p_state,
+                           int16_t *p_buf, uint16_t count);
+
+static void adc_biquad_tdf2(const adc_biquad_coef_t *p_coef,
+                            adc_biquad_state_t *p_state,
+                            int16_t *p_buf, uint16_t count);
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_biquad_init
+
+ Function Description:
+ @brief    Configures the cascade and clears the state of every section.
+
+ @param p_bq            Filter to be initialized
+ @param p_coef          Coefficients of each section, NULL to bypass
+ @param num_sections    Number of sections in p_coef
+ @param form            Structure used for every section
+
+ @return void
+ */
+void adc_biquad_init(adc_biquad_t *p_bq, const adc_biquad_coef_t *p_coef,
+                     uint8_t num_sections, adc_biquad_form_t form)
+{
+    if (p_coef == NULL)
+    {
+        num_sections = 0;
+    }
+    if (num_sections > ADC_BIQUAD_MAX_SECTIONS)
+    {
+        num_sections = ADC_BIQUAD_MAX_SECTIONS;
+    }
+
+    p_bq->p_coef = p_coef;
+    p_bq->num_sections = num_sections;
+    p_bq->form = (uint8_t)form;
+
+    for (uint8_t i = 0; i < ADC_BIQUAD_MAX_SECTIONS; i++)
+    {
+        p_bq->state[i].x1 = 0;
+        p_bq->state[i].x2 = 0;
+        p_bq->state[i].y1 = 0;
+        p_bq->state[i].y2 = 0;
+        p_bq->state[i].s1 = 0;
+        p_bq->state[i].s2 = 0;
+    }
+}
+
+/*
+ Function name:
+ adc_biquad_process
+
+ Function Description:
+ @brief    Runs a run of samples through every section in turn, one
+           section over the whole run at a time.
+
+ @param p_bq     Filter
+ @param p_buf    Samples, filtered in place
+ @param count    Number of samples
+
+ @return void
+ */
+void adc_biquad_process(adc_biquad_t *p_bq, int16_t *p_buf, uint16_t count)
+{
+    for (uint8_t i = 0; i < p_bq->num_sections; i++)
+    {
+        if (p_bq->form == ADC_BIQUAD_TDF2)
+        {
+            adc_biquad_tdf2(&p_bq->p_coef[i], &p_bq->state[i], p_buf, count);
+        }
+        else
+        {
+            adc_biquad_df1(&p_bq->p_coef[i], &p_bq->state[i], p_buf, count);
+        }
+    }
+}
+
+/*
+ Function name:
+ adc_biquad_saturate
+
+ Function Description:
+ @brief    Rounds a Q14 scaled accumulator back to a 16 bit sample.
+
+ @param val    Accumulator scaled by 2^14
+
+ @return sample saturated to 16 bits
+ */
+static int16_t adc_biquad_saturate(int64_t val)
+{
+    val = (val + ADC_BIQUAD_ROUND) >> ADC_BIQUAD_COEF_SHIFT;
+
+    if (val > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (val < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+
+    return (int16_t)val;
+}
+
+/*
+ Function name:
+ adc_biquad_df1
+
+ Function Description:
+ @brief    One direct form I section. Keeps input and output history, so
+           the state is plain 16 bit samples.
+
+ @param p_coef     Section coefficients
+ @param p_state    Section state
+ @param p_buf      Samples, filtered in place
+ @param count      Number of samples
+
+ @return void
+ */
+static void adc_biquad_df1(const adc_biquad_coef_t *p_coef,
+                           adc_biquad_state_t *p_state,
+                           int16_t *p_buf, uint16_t count)
+{
+    int32_t b0 = p_coef->b0, b1 = p_coef->b1, b2 = p_coef->b2;
+    int32_t a1 = p_coef->a1, a2 = p_coef->a2;
+    int16_t x1 = p_state->x1, x2 = p_state->x2;
+    int16_t y1 = p_state->y1, y2 = p_state->y2;
+
+    for (uint16_t n = 0; n < count; n++)
+    {
+        int16_t x0 = p_buf[n];
+        int64_t acc = (int64_t)(b0 * x0) + (b1 * x1) + (b2 * x2)
+                      - (a1 * y1) - (a2 * y2);
+        int16_t y0 = adc_biquad_saturate(acc);
+
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = y0;
+        p_buf[n] = y0;
+    }
+
+    p_state->x1 = x1;
+    p_state->x2 = x2;
+    p_state->y1 = y1;
+    p_state->y2 = y2;
+}
+
+/*
+ Function name:
+ adc_biquad_tdf2
+
+ Function Description:
+ @brief    One transposed direct form II section. Two state words instead
+           of four, kept at full Q14 precision.
+
+ @param p_coef     Section coefficients
+ @param p_state    Section state
+ @param p_buf      Samples, filtered in place
+ @param count      Number of samples
+
+ @return void
+ */
+static void adc_biquad_tdf2(const adc_biquad_coef_t *p_coef,
+                            adc_biquad_state_t *p_state,
+                            int16_t *p_buf, uint16_t count)
+{
+    int32_t b0 = p_coef->b0, b1 = p_coef->b1, b2 = p_coef->b2;
+    int32_t a1 = p_coef->a1, a2 = p_coef->a2;
+    int64_t s1 = p_state->s1, s2 = p_state->s2;
+
+    for (uint16_t n = 0; n < count; n++)
+    {
+        int32_t x0 = p_buf[n];
+        int16_t y0 = adc_biquad_saturate((int64_t)(b0 * x0) + s1);
+
+        s1 = (int64_t)(b1 * x0) - (a1 * y0) + s2;
+        s2 = (int64_t)(b2 * x0) - (a2 * y0);
+        p_buf[n] = y0;
+    }
+
+    p_state->s1 = s1;
+    p_state->s2 = s2;
+}
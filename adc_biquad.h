@@ -0,0 +1,114 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_biquad.h
+ *
+ * @brief
+ *  Fixed-point IIR biquad cascade, in direct form I or transposed direct
+ *  form II. Coefficients are computed offline or at configuration time;
+ *  the per-sample path is integer only.
+ */
+
+#ifndef ADC_BIQUAD_H
+#define ADC_BIQUAD_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Maximum number of second order sections per channel */
+#ifndef ADC_BIQUAD_MAX_SECTIONS
+#define ADC_BIQUAD_MAX_SECTIONS       2
+#endif
+
+/*
+ * Coefficients are Q2.14: a Q15 word with one headroom bit, since a1 of a
+ * low-pass section lies close to -2.
+ */
+#define ADC_BIQUAD_COEF_SHIFT         14
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef enum
+{
+    ADC_BIQUAD_DF1,                   /* Direct form I */
+    ADC_BIQUAD_TDF2,                  /* Transposed direct form II */
+} adc_biquad_form_t;
+
+/* y = b0 x + b1 x[-1] + b2 x[-2] - a1 y[-1] - a2 y[-2], a0 normalized to 1 */
+typedef struct
+{
+    int16_t b0;
+    int16_t b1;
+    int16_t b2;
+    int16_t a1;
+    int16_t a2;
+} adc_biquad_coef_t;
+
+typedef struct
+{
+    int16_t x1, x2;                   /* DF1 input history */
+    int16_t y1, y2;                   /* DF1 output history */
+    int64_t s1, s2;                   /* TDF2 state, scaled by 2^14 */
+} adc_biquad_state_t;
+
+typedef struct
+{
+    const adc_biquad_coef_t *p_coef;  /* num_sections coefficient sets */
+    uint8_t                  num_sections;   /* 0 bypasses the filter */
+    uint8_t                  form;           /* adc_biquad_form_t */
+    adc_biquad_state_t       state[ADC_BIQUAD_MAX_SECTIONS];
+} adc_biquad_t;
+
+/******************************************************************************
+ *                          Variables Definitions
+ ******************************************************************************/
+/* Butterworth low-pass presets, cut-off given as a fraction of the sample rate */
+extern const adc_biquad_coef_t adc_biquad_lp2_fs20[1];   /* 2nd order, fs/20 */
+extern const adc_biquad_coef_t adc_biquad_lp2_fs10[1];   /* 2nd order, fs/10 */
+extern const adc_biquad_coef_t adc_biquad_lp4_fs20[2];   /* 4th order, fs/20 */
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* num_sections is clamped to ADC_BIQUAD_MAX_SECTIONS */
+void adc_biquad_init(adc_biquad_t *p_bq, const adc_biquad_coef_t *p_coef,
+                     uint8_t num_sections, adc_biquad_form_t form);
+
+/* Filters count samples in place */
+void adc_biquad_process(adc_biquad_t *p_bq, int16_t *p_buf, uint16_t count);
+
+#endif /* ADC_BIQUAD_H */
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_block.c
+ *
+ * @brief
+ *  Sample blocks, filled one sample at a time and processed whole.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_block.h"
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_block_init
+
+ Function Description:
+ @brief    Empties the block and sets the number of samples per block.
+
+ @param p_block       Block to be initialized
+ @param block_size    Samples per block, clamped to 1..ADC_BLOCK_SIZE
+
+ @return void
+ */
+void adc_block_init(adc_block_t *p_block, uint16_t block_size)
+{
+    if (block_size == 0)
+    {
+        block_size = 1;
+    }
+    if (block_size > ADC_BLOCK_SIZE)
+    {
+        block_size = ADC_BLOCK_SIZE;
+    }
+
+    p_block->count = 0;
+    p_block->size = block_size;
+}
+
+/*
+ Function name:
+ adc_block_put
+
+ Function Description:
+ @brief    Appends one sample to the block. A completed block stays valid
+           until the next sample is put, which starts a new block.
+
+ @param p_block         Block
+ @param timestamp_us    Time of the acquisition, stored relative to the
+                        first acquisition of the block
+ @param raw             Signed raw sample value
+
+ @return 1 if the block has just been completed, 0 otherwise
+ */
+int adc_block_put(adc_block_t *p_block, uint64_t timestamp_us, int16_t raw)
+{
+    if (p_block->count >= p_block->size)
+    {
+        p_block->count = 0;
+    }
+
+    if (p_block->count == 0)
+    {
+        p_block->base_us = timestamp_us;
+    }
+
+    p_block->delta_us[p_block->count] = (uint32_t)(timestamp_us - p_block->base_us);
+    p_block->raw[p_block->count] = raw;
+
+    return (++p_block->count == p_block->size);
+}
+
+/*
+ Function name:
+ adc_block_time_us
+
+ Function Description:
+ @brief    Rebuilds the time of one sample of a block.
+
+ @param p_block    Block
+ @param idx        Sample index within the block
+
+ @return time of the acquisition in microseconds
+ */
+uint64_t adc_block_time_us(const adc_block_t *p_block, uint16_t idx)
+{
+    return p_block->base_us + p_block->delta_us[idx];
+}
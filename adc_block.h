@@ -0,0 +1,84 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_block.h
+ *
+ * @brief
+ *  Sample blocks. A block is filled sample by sample and, once complete,
+ *  processed as a whole before the next sample is put. The rings already
+ *  decouple sampling from processing, so a single block per channel is
+ *  enough. Samples are stored as separate arrays so processing stages can
+ *  run tight loops over contiguous raw values. Sample times are stored as
+ *  a 64 bit block base plus a 32 bit delta per sample.
+ */
+
+#ifndef ADC_BLOCK_H
+#define ADC_BLOCK_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Maximum number of samples per block, the used size is set at init */
+#ifndef ADC_BLOCK_SIZE
+#define ADC_BLOCK_SIZE                32
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Contiguous run of samples of one channel */
+typedef struct
+{
+    uint16_t count;                           /* Valid samples in the block */
+    uint16_t size;                            /* Samples per complete block */
+    uint64_t base_us;                         /* Time of the first acquisition */
+    uint32_t delta_us[ADC_BLOCK_SIZE];        /* Time of each acquisition after base_us */
+    int16_t  raw[ADC_BLOCK_SIZE];             /* Signed raw sample values */
+} adc_block_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* block_size is clamped to 1..ADC_BLOCK_SIZE */
+void adc_block_init(adc_block_t *p_block, uint16_t block_size);
+
+/* Appends a sample, returns 1 when this completed the block */
+int adc_block_put(adc_block_t *p_block, uint64_t timestamp_us, int16_t raw);
+
+/* Time of sample idx of a block */
+uint64_t adc_block_time_us(const adc_block_t *p_block, uint16_t idx);
+
+#endif /* ADC_BLOCK_H */
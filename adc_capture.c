@@ -0,0 +1,273 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_capture.c
+ *
+ * @brief
+ *  Pre-trigger capture. All storage is static in the capture object.
+ *  Every sample goes to a circular history, whatever the state, and the
+ *  history is copied into the window when the trigger fires. A capture
+ *  right after a re-arm thus still has a full pre-trigger part.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_capture.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define ADC_CAPTURE_PRE_MASK          (ADC_CAPTURE_PRE_SAMPLES - 1)
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+static int adc_capture_triggered(const adc_capture_t *p_cap, int16_t raw);
+
+static void adc_capture_history(adc_capture_t *p_cap, uint32_t timestamp_us,
+                                int16_t raw);
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_capture_init
+
+ Function Description:
+ @brief    Configures the trigger and arms the capture.
+
+ @param p_cap       Capture to be initialized
+ @param trigger     Trigger condition, ADC_CAPTURE_TRIG_NONE to disable
+ @param level       Level of the level and edge triggers
+ @param slope       Minimum step between samples of the slope trigger
+ @param post_len    Samples to record from the trigger on
+
+ @return void
+ */
+void adc_capture_init(adc_capture_t *p_cap, adc_capture_trigger_t trigger,
+                      int16_t level, int16_t slope, uint16_t post_len)
+{
+    if (post_len == 0)
+    {
+        post_len = 1;
+    }
+    if (post_len > ADC_CAPTURE_POST_MAX)
+    {
+        post_len = ADC_CAPTURE_POST_MAX;
+    }
+
+    p_cap->trigger = (uint8_t)trigger;
+    p_cap->level = level;
+    p_cap->slope = slope;
+    p_cap->post_len = post_len;
+    p_cap->hist_head = 0;
+    p_cap->hist_count = 0;
+    p_cap->pre_count = 0;
+    p_cap->has_prev = 0;
+
+    adc_capture_rearm(p_cap);
+}
+
+/*
+ Function name:
+ adc_capture_add
+
+ Function Description:
+ @brief    Feeds one sample to the capture. While armed, a sample that
+           meets the trigger condition freezes the history as the
+           pre-trigger part of the window; once triggered, samples are
+           recorded as post-trigger samples. Every sample then goes to
+           the history.
+
+ @param p_cap           Capture
+ @param timestamp_us    Time of the acquisition
+ @param raw             Raw sample value
+
+ @return 1 if this sample completed the window, 0 otherwise
+ */
+int adc_capture_add(adc_capture_t *p_cap, uint32_t timestamp_us, int16_t raw)
+{
+    int completed = 0;
+
+    if (p_cap->trigger == ADC_CAPTURE_TRIG_NONE)
+    {
+        return 0;
+    }
+
+    if ((p_cap->state == ADC_CAPTURE_ARMED) && adc_capture_triggered(p_cap, raw))
+    {
+        for (uint16_t i = 0; i < p_cap->hist_count; i++)
+        {
+            uint16_t slot = (p_cap->hist_head - p_cap->hist_count + i) & ADC_CAPTURE_PRE_MASK;
+
+            p_cap->pre_raw[i] = p_cap->hist_raw[slot];
+            p_cap->pre_timestamp_us[i] = p_cap->hist_timestamp_us[slot];
+        }
+        p_cap->pre_count = p_cap->hist_count;
+        p_cap->state = ADC_CAPTURE_TRIGGERED;
+    }
+
+    if (p_cap->state == ADC_CAPTURE_TRIGGERED)
+    {
+        p_cap->post_raw[p_cap->post_count] = raw;
+        p_cap->post_timestamp_us[p_cap->post_count] = timestamp_us;
+
+        if (++p_cap->post_count == p_cap->post_len)
+        {
+            p_cap->state = ADC_CAPTURE_FROZEN;
+            completed = 1;
+        }
+    }
+
+    adc_capture_history(p_cap, timestamp_us, raw);
+
+    return completed;
+}
+
+/*
+ Function name:
+ adc_capture_get
+
+ Function Description:
+ @brief    Reads one sample of the frozen window in time order.
+
+ @param p_cap             Capture
+ @param idx               Sample index, 0 is the oldest pre-trigger sample
+ @param p_timestamp_us    Receives the time of the sample
+ @param p_raw             Receives the raw value of the sample
+
+ @return void
+ */
+void adc_capture_get(const adc_capture_t *p_cap, uint16_t idx,
+                     uint32_t *p_timestamp_us, int16_t *p_raw)
+{
+    if (idx < p_cap->pre_count)
+    {
+        *p_timestamp_us = p_cap->pre_timestamp_us[idx];
+        *p_raw = p_cap->pre_raw[idx];
+        return;
+    }
+
+    idx -= p_cap->pre_count;
+    *p_timestamp_us = p_cap->post_timestamp_us[idx];
+    *p_raw = p_cap->post_raw[idx];
+}
+
+/*
+ Function name:
+ adc_capture_rearm
+
+ Function Description:
+ @brief    Discards the window and waits for the next trigger. Only the
+           trigger and post-trigger state is reset: the history and the
+           previous sample carry on, so the next window gets its full
+           pre-trigger part and edges spanning the re-arm are detected.
+
+ @param p_cap    Capture
+
+ @return void
+ */
+void adc_capture_rearm(adc_capture_t *p_cap)
+{
+    p_cap->post_count = 0;
+    p_cap->state = ADC_CAPTURE_ARMED;
+}
+
+/*
+ Function name:
+ adc_capture_triggered
+
+ Function Description:
+ @brief    Evaluates the trigger condition for a sample.
+
+ @param p_cap    Capture
+ @param raw      Raw sample value
+
+ @return non-zero if the sample meets the trigger condition
+ */
+static int adc_capture_triggered(const adc_capture_t *p_cap, int16_t raw)
+{
+    int32_t step = (int32_t)raw - p_cap->prev;
+
+    switch (p_cap->trigger)
+    {
+    case ADC_CAPTURE_TRIG_LEVEL:
+        return raw >= p_cap->level;
+
+    case ADC_CAPTURE_TRIG_RISING:
+        return p_cap->has_prev && (p_cap->prev < p_cap->level) && (raw >= p_cap->level);
+
+    case ADC_CAPTURE_TRIG_FALLING:
+        return p_cap->has_prev && (p_cap->prev > p_cap->level) && (raw <= p_cap->level);
+
+    case ADC_CAPTURE_TRIG_SLOPE:
+        return p_cap->has_prev && ((step >= p_cap->slope) || (-step >= p_cap->slope));
+
+    default:
+        return 0;
+    }
+}
+
+/*
+ Function name:
+ adc_capture_history
+
+ Function Description:
+ @brief    Appends a sample to the circular history, overwriting the
+           oldest one when full, and remembers it for the edge and slope
+           triggers.
+
+ @param p_cap           Capture
+ @param timestamp_us    Time of the acquisition
+ @param raw             Raw sample value
+
+ @return void
+ */
+static void adc_capture_history(adc_capture_t *p_cap, uint32_t timestamp_us,
+                                int16_t raw)
+{
+    p_cap->hist_raw[p_cap->hist_head] = raw;
+    p_cap->hist_timestamp_us[p_cap->hist_head] = timestamp_us;
+    p_cap->hist_head = (p_cap->hist_head + 1) & ADC_CAPTURE_PRE_MASK;
+    if (p_cap->hist_count < ADC_CAPTURE_PRE_SAMPLES)
+    {
+        p_cap->hist_count++;
+    }
+
+    p_cap->prev = raw;
+    p_cap->has_prev = 1;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_capture.h
+ *
+ * @brief
+ *  Oscilloscope style capture. A circular pre-trigger buffer always holds
+ *  the latest samples; when the trigger condition is met, a configurable
+ *  number of post-trigger samples is recorded and the window is frozen
+ *  until it has been shipped.
+ */
+
+#ifndef ADC_CAPTURE_H
+#define ADC_CAPTURE_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Samples kept before the trigger, a power of two */
+#ifndef ADC_CAPTURE_PRE_SAMPLES
+#define ADC_CAPTURE_PRE_SAMPLES       16
+#endif
+
+/* Maximum samples recorded from the trigger on */
+#ifndef ADC_CAPTURE_POST_MAX
+#define ADC_CAPTURE_POST_MAX          32
+#endif
+
+#if (ADC_CAPTURE_PRE_SAMPLES & (ADC_CAPTURE_PRE_SAMPLES - 1)) != 0
+#error "ADC_CAPTURE_PRE_SAMPLES must be a power of two"
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef enum
+{
+    ADC_CAPTURE_TRIG_NONE,            /* Capture disabled */
+    ADC_CAPTURE_TRIG_LEVEL,           /* Sample at or above the level */
+    ADC_CAPTURE_TRIG_RISING,          /* Crossing the level upwards */
+    ADC_CAPTURE_TRIG_FALLING,         /* Crossing the level downwards */
+    ADC_CAPTURE_TRIG_SLOPE,           /* Step between samples of at least slope */
+} adc_capture_trigger_t;
+
+typedef enum
+{
+    ADC_CAPTURE_ARMED,                /* Filling the pre-trigger buffer */
+    ADC_CAPTURE_TRIGGERED,            /* Recording post-trigger samples */
+    ADC_CAPTURE_FROZEN,               /* Window complete, waiting to be shipped */
+} adc_capture_state_t;
+
+typedef struct
+{
+    int16_t  hist_raw[ADC_CAPTURE_PRE_SAMPLES];       /* Latest samples, circular */
+    uint32_t hist_timestamp_us[ADC_CAPTURE_PRE_SAMPLES];
+    int16_t  pre_raw[ADC_CAPTURE_PRE_SAMPLES];        /* History at the trigger, oldest first */
+    uint32_t pre_timestamp_us[ADC_CAPTURE_PRE_SAMPLES];
+    int16_t  post_raw[ADC_CAPTURE_POST_MAX];          /* post_raw[0] is the trigger sample */
+    uint32_t post_timestamp_us[ADC_CAPTURE_POST_MAX];
+    uint16_t hist_head;               /* Next history slot to overwrite */
+    uint16_t hist_count;              /* Valid history samples */
+    uint16_t pre_count;               /* Pre-trigger samples of the window */
+    uint16_t post_count;              /* Post-trigger samples recorded */
+    uint16_t post_len;                /* Post-trigger samples to record */
+    int16_t  level;                   /* Level of the level and edge triggers */
+    int16_t  slope;                   /* Step of the slope trigger */
+    int16_t  prev;                    /* Previous sample, for edges and slope */
+    uint8_t  has_prev;
+    uint8_t  trigger;                 /* adc_capture_trigger_t */
+    uint8_t  state;                   /* adc_capture_state_t */
+} adc_capture_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* post_len is clamped to 1..ADC_CAPTURE_POST_MAX */
+void adc_capture_init(adc_capture_t *p_cap, adc_capture_trigger_t trigger,
+                      int16_t level, int16_t slope, uint16_t post_len);
+
+/* Adds a sample, returns 1 when it completed (froze) the window */
+int adc_capture_add(adc_capture_t *p_cap, uint32_t timestamp_us, int16_t raw);
+
+/*
+ * Sample idx of the frozen window, oldest first. The window holds
+ * pre_count + post_count samples and the trigger sample is at pre_count.
+ */
+void adc_capture_get(const adc_capture_t *p_cap, uint16_t idx,
+                     uint32_t *p_timestamp_us, int16_t *p_raw);
+
+/*
+ * Releases a shipped window and waits for the next trigger. The history
+ * keeps filling meanwhile, so the next window has a full pre-trigger part.
+ */
+void adc_capture_rearm(adc_capture_t *p_cap);
+
+#endif /* ADC_CAPTURE_H */
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_cic.c
+ *
+ * @brief
+ *  CIC decimator. Integrators run at the input rate and combs at the
+ *  output rate, both with additions and subtractions only. Registers are
+ *  unsigned so that integrator overflow wraps, which the combs undo as
+ *  long as the total bit growth fits the register width.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_cic.h"
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+static int16_t adc_cic_compensate(adc_cic_t *p_cic, int32_t val);
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_cic_init
+
+ Function Description:
+ @brief    Configures the decimator and clears its state.
+
+ @param p_cic          Decimator to be initialized
+ @param order          Number of integrator/comb stages, 0 to bypass
+ @param ratio_shift    log2 of the decimation ratio
+ @param compensate     Non-zero to apply the droop compensation FIR
+
+ @return 1 on success, 0 if the configuration is not supported
+ */
+int adc_cic_init(adc_cic_t *p_cic, uint8_t order, uint8_t ratio_shift,
+                 uint8_t compensate)
+{
+    if ((order > ADC_CIC_MAX_ORDER) ||
+        (order * ratio_shift > ADC_CIC_MAX_GROWTH_BITS))
+    {
+        p_cic->order = 0;
+        return 0;
+    }
+
+    p_cic->order = order;
+    p_cic->ratio_shift = ratio_shift;
+    p_cic->compensate = compensate;
+    p_cic->phase = 0;
+
+    for (uint8_t i = 0; i < ADC_CIC_MAX_ORDER; i++)
+    {
+        p_cic->integrator[i] = 0;
+        p_cic->comb_delay[i] = 0;
+    }
+    p_cic->comp_delay[0] = 0;
+    p_cic->comp_delay[1] = 0;
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_cic_process
+
+ Function Description:
+ @brief    Runs the decimator over a run of input samples. The phase of
+           the decimation carries over between calls.
+
+ @param p_cic    Decimator
+ @param p_in     Input samples
+ @param p_out    Decimated output, may be the same buffer as p_in
+ @param count    Number of input samples
+
+ @return number of output samples written
+ */
+uint16_t adc_cic_process(adc_cic_t *p_cic, const int16_t *p_in, int16_t *p_out,
+                         uint16_t count)
+{
+    uint8_t order = p_cic->order;
+    uint32_t ratio_mask = (1u << p_cic->ratio_shift) - 1;
+    uint16_t num_out = 0;
+
+    if (order == 0)
+    {
+        for (uint16_t n = 0; n < count; n++)
+        {
+            p_out[n] = p_in[n];
+        }
+        return count;
+    }
+
+    for (uint16_t n = 0; n < count; n++)
+    {
+        uint32_t acc = (uint32_t)(int32_t)p_in[n];
+
+        for (uint8_t i = 0; i < order; i++)
+        {
+            p_cic->integrator[i] += acc;
+            acc = p_cic->integrator[i];
+        }
+
+        if ((++p_cic->phase & ratio_mask) != 0)
+        {
+            continue;
+        }
+        p_cic->phase = 0;
+
+        for (uint8_t i = 0; i < order; i++)
+        {
+            uint32_t prev = p_cic->comb_delay[i];
+            p_cic->comb_delay[i] = acc;
+            acc -= prev;
+        }
+
+        /* Remove the ratio^order gain of the filter */
+        int32_t val = (int32_t)acc >> (order * p_cic->ratio_shift);
+
+        /* Output index never passes the input index, so aliasing is safe */
+        p_out[num_out++] = p_cic->compensate ? adc_cic_compensate(p_cic, val)
+                                             : (int16_t)val;
+    }
+
+    return num_out;
+}
+
+/*
+ Function name:
+ adc_cic_compensate
+
+ Function Description:
+ @brief    Three tap FIR [-1, 10, -1] / 8 at the output rate, a cheap
+           high frequency boost that flattens the passband droop of the
+           CIC filter. Uses shifts and additions only.
+
+ @param p_cic    Decimator holding the compensator state
+ @param val      Decimated sample
+
+ @return compensated sample, saturated to 16 bits
+ */
+static int16_t adc_cic_compensate(adc_cic_t *p_cic, int32_t val)
+{
+    int32_t mid = p_cic->comp_delay[0];
+    int32_t out = ((mid << 3) + (mid << 1) - val - p_cic->comp_delay[1]) >> 3;
+
+    p_cic->comp_delay[1] = mid;
+    p_cic->comp_delay[0] = val;
+
+    if (out > INT16_MAX)
+    {
+        out = INT16_MAX;
+    }
+    if (out < INT16_MIN)
+    {
+        out = INT16_MIN;
+    }
+
+    return (int16_t)out;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_cic.h
+ *
+ * @brief
+ *  Integer cascaded-integrator-comb (CIC) decimator with an optional
+ *  droop compensation FIR. The decimation ratio is a power of two so the
+ *  gain of the filter is removed with a shift.
+ */
+
+#ifndef ADC_CIC_H
+#define ADC_CIC_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Maximum number of integrator/comb stages */
+#define ADC_CIC_MAX_ORDER             4
+
+/*
+ * Register width left for bit growth. A 16 bit input grows by
+ * order * log2(ratio) bits, which must fit in 32 bit registers.
+ */
+#define ADC_CIC_MAX_GROWTH_BITS       16
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint8_t  order;                           /* Stages, 0 disables the filter */
+    uint8_t  ratio_shift;                     /* Decimation ratio is 1 << ratio_shift */
+    uint8_t  compensate;                      /* Apply droop compensation */
+    uint32_t phase;                           /* Inputs since the last output, up to 2^16 */
+    uint32_t integrator[ADC_CIC_MAX_ORDER];   /* Wrapping integrator state */
+    uint32_t comb_delay[ADC_CIC_MAX_ORDER];   /* Previous comb inputs */
+    int32_t  comp_delay[2];                   /* Previous compensator inputs */
+} adc_cic_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* Returns 0 if the order and ratio do not fit the register width */
+int adc_cic_init(adc_cic_t *p_cic, uint8_t order, uint8_t ratio_shift,
+                 uint8_t compensate);
+
+/*
+ * Filters count input samples and writes the decimated outputs to p_out,
+ * which may alias p_in. Returns the number of outputs written.
+ */
+uint16_t adc_cic_process(adc_cic_t *p_cic, const int16_t *p_in, int16_t *p_out,
+                         uint16_t count);
+
+#endif /* ADC_CIC_H */
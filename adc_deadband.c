@@ -0,0 +1,113 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_deadband.c
+ *
+ * @brief
+ *  Deadband change suppression. An unchanged value costs a subtraction
+ *  and two comparisons; timestamps are compared by wrapping difference.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_deadband.h"
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_deadband_init
+
+ Function Description:
+ @brief    Configures the filter. The first value is always reported.
+
+ @param p_db            Filter to be initialized
+ @param enabled         0 to disable the filter
+ @param deadband        Change needed to report, in sample units
+ @param heartbeat_us    Longest time without a report, 0 for none
+
+ @return void
+ */
+void adc_deadband_init(adc_deadband_t *p_db, uint8_t enabled, uint16_t deadband,
+                       uint32_t heartbeat_us)
+{
+    p_db->heartbeat_us = heartbeat_us;
+    p_db->last_time_us = 0;
+    p_db->suppressed = 0;
+    p_db->last = 0;
+    p_db->deadband = deadband;
+    p_db->primed = 0;
+    p_db->enabled = enabled;
+}
+
+/*
+ Function name:
+ adc_deadband_check
+
+ Function Description:
+ @brief    Decides whether a value is worth reporting.
+
+ @param p_db            Filter
+ @param x               Value
+ @param timestamp_us    Time of the value
+
+ @return 1 if the value is to be reported, 0 if it is suppressed
+ */
+int adc_deadband_check(adc_deadband_t *p_db, int16_t x, uint32_t timestamp_us)
+{
+    int32_t delta = (int32_t)x - p_db->last;
+
+    if (!p_db->enabled)
+    {
+        return 0;
+    }
+
+    if (p_db->primed &&
+        (delta <= p_db->deadband) && (-delta <= p_db->deadband) &&
+        ((p_db->heartbeat_us == 0) ||
+         ((timestamp_us - p_db->last_time_us) < p_db->heartbeat_us)))
+    {
+        p_db->suppressed++;
+        return 0;
+    }
+
+    p_db->last = x;
+    p_db->last_time_us = timestamp_us;
+    p_db->primed = 1;
+
+    return 1;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_deadband.h
+ *
+ * @brief
+ *  Report-by-exception filter. A value is reported only if it moved more
+ *  than a deadband since the last reported value, or if a heartbeat
+ *  interval expired without a report.
+ */
+
+#ifndef ADC_DEADBAND_H
+#define ADC_DEADBAND_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t heartbeat_us;            /* Longest time without a report, 0 for none */
+    uint32_t last_time_us;            /* Time of the last report */
+    uint32_t suppressed;              /* Values not reported */
+    int16_t  last;                    /* Last reported value */
+    uint16_t deadband;                /* Change needed to report, in sample units */
+    uint8_t  primed;                  /* A value has been reported */
+    uint8_t  enabled;
+} adc_deadband_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+void adc_deadband_init(adc_deadband_t *p_db, uint8_t enabled, uint16_t deadband,
+                       uint32_t heartbeat_us);
+
+/* Returns 1 if the value is to be reported, and then records it as reported */
+int adc_deadband_check(adc_deadband_t *p_db, int16_t x, uint32_t timestamp_us);
+
+#endif /* ADC_DEADBAND_H */
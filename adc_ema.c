@@ -0,0 +1,117 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_ema.c
+ *
+ * @brief
+ *  Shift-only exponential moving average. The first sample seeds the
+ *  state so the output does not ramp up from zero.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_ema.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define ADC_EMA_ROUND                 (1 << (ADC_EMA_FRAC_BITS - 1))
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_ema_init
+
+ Function Description:
+ @brief    Configures the average and clears its state.
+
+ @param p_ema    Average to be initialized
+ @param shift    Coefficient is 1 / 2^shift, 0 to bypass
+
+ @return void
+ */
+void adc_ema_init(adc_ema_t *p_ema, uint8_t shift)
+{
+    if (shift > ADC_EMA_MAX_SHIFT)
+    {
+        shift = ADC_EMA_MAX_SHIFT;
+    }
+
+    p_ema->acc = 0;
+    p_ema->shift = shift;
+    p_ema->primed = 0;
+}
+
+/*
+ Function name:
+ adc_ema_process
+
+ Function Description:
+ @brief    Updates the average with each sample and replaces the sample
+           by the rounded average.
+
+ @param p_ema    Average
+ @param p_buf    Samples, filtered in place
+ @param count    Number of samples
+
+ @return void
+ */
+void adc_ema_process(adc_ema_t *p_ema, int16_t *p_buf, uint16_t count)
+{
+    uint8_t shift = p_ema->shift;
+    int32_t acc = p_ema->acc;
+
+    if ((shift == 0) || (count == 0))
+    {
+        return;
+    }
+
+    if (!p_ema->primed)
+    {
+        acc = (int32_t)p_buf[0] << ADC_EMA_FRAC_BITS;
+        p_ema->primed = 1;
+    }
+
+    for (uint16_t n = 0; n < count; n++)
+    {
+        acc += (((int32_t)p_buf[n] << ADC_EMA_FRAC_BITS) - acc) >> shift;
+        p_buf[n] = (int16_t)((acc + ADC_EMA_ROUND) >> ADC_EMA_FRAC_BITS);
+    }
+
+    p_ema->acc = acc;
+}
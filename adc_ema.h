@@ -0,0 +1,78 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_ema.h
+ *
+ * @brief
+ *  Exponential moving average with a power of two coefficient,
+ *  y += (x - y) / 2^shift, computed with shifts and additions only.
+ */
+
+#ifndef ADC_EMA_H
+#define ADC_EMA_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/*
+ * Fractional bits kept in the state. Without them the truncation of
+ * (x - y) >> shift biases the output by up to 2^shift counts.
+ */
+#define ADC_EMA_FRAC_BITS             8
+
+/* Largest supported shift, keeps the Q8 state of a 16 bit input in 32 bits */
+#define ADC_EMA_MAX_SHIFT             15
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    int32_t acc;                      /* Average, with ADC_EMA_FRAC_BITS fraction */
+    uint8_t shift;                    /* Coefficient is 1 / 2^shift, 0 bypasses */
+    uint8_t primed;                   /* acc holds a value */
+} adc_ema_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* shift is clamped to ADC_EMA_MAX_SHIFT, 0 bypasses the stage */
+void adc_ema_init(adc_ema_t *p_ema, uint8_t shift);
+
+/* Filters count samples in place */
+void adc_ema_process(adc_ema_t *p_ema, int16_t *p_buf, uint16_t count);
+
+#endif /* ADC_EMA_H */
@@ -0,0 +1,200 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_expr.c
+ *
+ * @brief
+ *  Postfix integer expression evaluator. All validation is done by
+ *  adc_expr_check() when the program is set up, so evaluation is a
+ *  straight loop over the operations.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_expr.h"
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_expr_check
+
+ Function Description:
+ @brief    Validates a program by tracking the stack depth of every
+           operation.
+
+ @param p_prog        Program
+ @param len           Operations in the program
+ @param num_inputs    Inputs available to ADC_EXPR_INPUT
+
+ @return 1 if the program can be evaluated, 0 otherwise
+ */
+int adc_expr_check(const adc_expr_op_t *p_prog, uint8_t len, uint8_t num_inputs)
+{
+    uint8_t depth = 0;
+
+    if ((len == 0) || (len > ADC_EXPR_MAX_OPS))
+    {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < len; i++)
+    {
+        switch (p_prog[i].op)
+        {
+        case ADC_EXPR_INPUT:
+            if ((p_prog[i].arg < 0) || (p_prog[i].arg >= num_inputs))
+            {
+                return 0;
+            }
+            /* Fall through */
+        case ADC_EXPR_CONST:
+            if (depth == ADC_EXPR_STACK_SIZE)
+            {
+                return 0;
+            }
+            depth++;
+            break;
+
+        case ADC_EXPR_NEG:
+            if (depth < 1)
+            {
+                return 0;
+            }
+            break;
+
+        case ADC_EXPR_ADD:
+        case ADC_EXPR_SUB:
+        case ADC_EXPR_MUL:
+        case ADC_EXPR_DIV:
+        case ADC_EXPR_SHL:
+        case ADC_EXPR_SHR:
+            if (depth < 2)
+            {
+                return 0;
+            }
+            depth--;
+            break;
+
+        default:
+            return 0;
+        }
+    }
+
+    return (depth == 1);
+}
+
+/*
+ Function name:
+ adc_expr_eval
+
+ Function Description:
+ @brief    Runs a program checked by adc_expr_check.
+
+ @param p_prog      Program
+ @param len         Operations in the program
+ @param p_inputs    Values read by ADC_EXPR_INPUT
+
+ @return value of the expression, saturated to 16 bits
+ */
+int16_t adc_expr_eval(const adc_expr_op_t *p_prog, uint8_t len,
+                      const int16_t *p_inputs)
+{
+    int32_t stack[ADC_EXPR_STACK_SIZE];
+    int32_t *p_top = stack - 1;
+    int32_t b;
+
+    for (uint8_t i = 0; i < len; i++)
+    {
+        switch (p_prog[i].op)
+        {
+        case ADC_EXPR_INPUT:
+            *++p_top = p_inputs[p_prog[i].arg];
+            break;
+
+        case ADC_EXPR_CONST:
+            *++p_top = p_prog[i].arg;
+            break;
+
+        case ADC_EXPR_NEG:
+            *p_top = (int32_t)(0u - (uint32_t)*p_top);
+            break;
+
+        default:
+            b = *p_top--;
+            switch (p_prog[i].op)
+            {
+            case ADC_EXPR_ADD:
+                *p_top = (int32_t)((uint32_t)*p_top + (uint32_t)b);
+                break;
+            case ADC_EXPR_SUB:
+                *p_top = (int32_t)((uint32_t)*p_top - (uint32_t)b);
+                break;
+            case ADC_EXPR_MUL:
+                *p_top = (int32_t)((uint32_t)*p_top * (uint32_t)b);
+                break;
+            case ADC_EXPR_DIV:
+                if (b == -1)
+                {
+                    *p_top = (int32_t)(0u - (uint32_t)*p_top);
+                }
+                else
+                {
+                    *p_top = (b != 0) ? (*p_top / b) : 0;
+                }
+                break;
+            case ADC_EXPR_SHL:
+                *p_top = (int32_t)((uint32_t)*p_top << (b & 31));
+                break;
+            case ADC_EXPR_SHR:
+                *p_top >>= (b & 31);
+                break;
+            }
+            break;
+        }
+    }
+
+    if (stack[0] > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (stack[0] < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)stack[0];
+}
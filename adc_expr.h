@@ -0,0 +1,95 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_expr.h
+ *
+ * @brief
+ *  Integer expressions over sample values, stored as a postfix (RPN)
+ *  program. A program is checked once, then evaluated without any checks
+ *  on a fixed size stack of 32 bit values; arithmetic wraps at 32 bits.
+ */
+
+#ifndef ADC_EXPR_H
+#define ADC_EXPR_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Longest program and deepest stack */
+#define ADC_EXPR_MAX_OPS              16
+#define ADC_EXPR_STACK_SIZE           8
+
+/* Program building helpers */
+#define ADC_EXPR_IN(n)                { ADC_EXPR_INPUT, (n) }
+#define ADC_EXPR_K(k)                 { ADC_EXPR_CONST, (k) }
+#define ADC_EXPR_OP(op)               { (op), 0 }
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef enum
+{
+    ADC_EXPR_INPUT,                   /* Push input arg */
+    ADC_EXPR_CONST,                   /* Push arg */
+    ADC_EXPR_ADD,                     /* Pop b, a, push a + b */
+    ADC_EXPR_SUB,                     /* a - b */
+    ADC_EXPR_MUL,                     /* a * b */
+    ADC_EXPR_DIV,                     /* a / b truncated, 0 if b is 0 */
+    ADC_EXPR_SHL,                     /* a << b, b of 0..31 */
+    ADC_EXPR_SHR,                     /* a >> b arithmetic, b of 0..31 */
+    ADC_EXPR_NEG,                     /* Pop a, push -a */
+} adc_expr_opcode_t;
+
+typedef struct
+{
+    uint8_t op;                       /* adc_expr_opcode_t */
+    int16_t arg;                      /* Input index or constant */
+} adc_expr_op_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/*
+ * Checks that a program reads inputs below num_inputs only, fits the
+ * stack and leaves exactly one value. Returns 1 if it does.
+ */
+int adc_expr_check(const adc_expr_op_t *p_prog, uint8_t len, uint8_t num_inputs);
+
+/* Evaluates a checked program, the result is saturated to 16 bits */
+int16_t adc_expr_eval(const adc_expr_op_t *p_prog, uint8_t len,
+                      const int16_t *p_inputs);
+
+#endif /* ADC_EXPR_H */
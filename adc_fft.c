@@ -0,0 +1,176 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_fft.c
+ *
+ * @brief
+ *  Decimation in time radix-2 FFT. The twiddle table holds one set of
+ *  factors for ADC_FFT_MAX_POINTS; smaller transforms step through it.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_fft.h"
+#include "adc_trig.h"
+#include "adc_stats.h"
+
+/******************************************************************************
+ *                          Variables Definitions
+ ******************************************************************************/
+/* e^(-j * 2 * pi * k / ADC_FFT_MAX_POINTS) for k < ADC_FFT_MAX_POINTS / 2, Q15 */
+static int16_t adc_fft_twiddle_re[ADC_FFT_MAX_POINTS / 2];
+static int16_t adc_fft_twiddle_im[ADC_FFT_MAX_POINTS / 2];
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_fft_init
+
+ Function Description:
+ @brief    Computes the twiddle table for ADC_FFT_MAX_POINTS.
+
+ @return void
+ */
+void adc_fft_init(void)
+{
+    for (uint16_t k = 0; k < ADC_FFT_MAX_POINTS / 2; k++)
+    {
+        uint16_t phase = (uint16_t)((65536UL / ADC_FFT_MAX_POINTS) * k);
+
+        adc_fft_twiddle_re[k] = adc_cos_q15(phase);
+        adc_fft_twiddle_im[k] = (int16_t)-adc_sin_q15(phase);
+    }
+}
+
+/*
+ Function name:
+ adc_fft_q15
+
+ Function Description:
+ @brief    Bit reverses the input order, then runs log2(n) butterfly
+           stages, halving the data at every stage.
+
+ @param p_re    Real parts, transformed in place
+ @param p_im    Imaginary parts, transformed in place
+ @param n       Number of points
+
+ @return 1 on success, 0 if n is not supported
+ */
+int adc_fft_q15(int16_t *p_re, int16_t *p_im, uint16_t n)
+{
+    uint16_t j = 0;
+
+    if ((n < 2) || (n > ADC_FFT_MAX_POINTS) || ((n & (n - 1)) != 0))
+    {
+        return 0;
+    }
+
+    for (uint16_t i = 0; i < n - 1; i++)
+    {
+        uint16_t bit;
+
+        if (i < j)
+        {
+            int16_t t = p_re[i];
+            p_re[i] = p_re[j];
+            p_re[j] = t;
+            t = p_im[i];
+            p_im[i] = p_im[j];
+            p_im[j] = t;
+        }
+
+        for (bit = n >> 1; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j |= bit;
+    }
+
+    for (uint16_t half = 1; half < n; half <<= 1)
+    {
+        uint16_t stride = ADC_FFT_MAX_POINTS / (half << 1);
+
+        for (uint16_t k = 0; k < half; k++)
+        {
+            int32_t w_re = adc_fft_twiddle_re[k * stride];
+            int32_t w_im = adc_fft_twiddle_im[k * stride];
+
+            for (uint16_t a = k; a < n; a += half << 1)
+            {
+                uint16_t b = a + half;
+                int32_t t_re = ((w_re * p_re[b]) - (w_im * p_im[b])) >> 15;
+                int32_t t_im = ((w_re * p_im[b]) + (w_im * p_re[b])) >> 15;
+                int32_t u_re = p_re[a];
+                int32_t u_im = p_im[a];
+
+                p_re[a] = (int16_t)((u_re + t_re) >> 1);
+                p_im[a] = (int16_t)((u_im + t_im) >> 1);
+                p_re[b] = (int16_t)((u_re - t_re) >> 1);
+                p_im[b] = (int16_t)((u_im - t_im) >> 1);
+            }
+        }
+    }
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_fft_magnitude
+
+ Function Description:
+ @brief    Computes the magnitude of the non-negative frequency bins.
+
+ @param p_re     Real parts of the transform
+ @param p_im     Imaginary parts of the transform
+ @param n        Number of points of the transform
+ @param p_mag    Receives n / 2 magnitudes
+
+ @return void
+ */
+void adc_fft_magnitude(const int16_t *p_re, const int16_t *p_im, uint16_t n,
+                       uint16_t *p_mag)
+{
+    for (uint16_t k = 0; k < n / 2; k++)
+    {
+        uint32_t power = (uint32_t)((int32_t)p_re[k] * p_re[k]) +
+                         (uint32_t)((int32_t)p_im[k] * p_im[k]);
+
+        p_mag[k] = (uint16_t)adc_isqrt64(power);
+    }
+}
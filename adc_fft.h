@@ -0,0 +1,76 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_fft.h
+ *
+ * @brief
+ *  In-place radix-2 fixed-point FFT for spectra of captured sample
+ *  bursts. Data is Q15 and every stage scales by 1/2, so the result is
+ *  the DFT divided by N and can not overflow.
+ */
+
+#ifndef ADC_FFT_H
+#define ADC_FFT_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Largest transform size, a power of two; sizes the twiddle table */
+#ifndef ADC_FFT_MAX_POINTS
+#define ADC_FFT_MAX_POINTS            256
+#endif
+
+#if (ADC_FFT_MAX_POINTS & (ADC_FFT_MAX_POINTS - 1)) != 0
+#error "ADC_FFT_MAX_POINTS must be a power of two"
+#endif
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* Fills the twiddle table, call once before any transform */
+void adc_fft_init(void);
+
+/*
+ * Transforms n points in place, n a power of two in 2..ADC_FFT_MAX_POINTS.
+ * Returns 0 if n is not supported.
+ */
+int adc_fft_q15(int16_t *p_re, int16_t *p_im, uint16_t n);
+
+/* Magnitude of bins 0..n/2-1 of a transform result */
+void adc_fft_magnitude(const int16_t *p_re, const int16_t *p_im, uint16_t n,
+                       uint16_t *p_mag);
+
+#endif /* ADC_FFT_H */
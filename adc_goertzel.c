@@ -0,0 +1,195 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_goertzel.c
+ *
+ * @brief
+ *  Goertzel resonators, one multiply-accumulate per tone and sample.
+ *  The power of each tone is only evaluated at block end, where it is
+ *  converted to a peak amplitude in raw counts.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_goertzel.h"
+#include "adc_trig.h"
+#include "adc_stats.h"
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_goertzel_init
+
+ Function Description:
+ @brief    Computes the resonator coefficient of every target frequency
+           and clears the state. A tone is rejected when the resonator
+           could overflow over one block: with the input bounded by 2^16
+           after DC removal, the state stays below N * 2^16 / sin(w), which
+           is kept under 2^30 so the power terms fit in 64 bits. This
+           holds while 4 * N^2 < sin^2(w) in Q30, i.e. low targets and
+           targets near half the sample rate need shorter blocks.
+
+ @param p_gz          Detector to be initialized
+ @param p_freq_mhz    Target frequencies in mHz
+ @param num_tones     Number of targets, 0 to disable
+ @param rate_mhz      Sample rate of the input in mHz
+ @param block_len     Samples per result
+
+ @return 1 on success, 0 if the configuration is not supported
+ */
+int adc_goertzel_init(adc_goertzel_t *p_gz, const uint32_t *p_freq_mhz,
+                      uint8_t num_tones, uint32_t rate_mhz, uint16_t block_len)
+{
+    p_gz->num_tones = 0;
+
+    if (num_tones == 0)
+    {
+        return 1;
+    }
+    if ((num_tones > ADC_GOERTZEL_MAX_TONES) || (block_len < 2))
+    {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < num_tones; i++)
+    {
+        if (p_freq_mhz[i] > rate_mhz / 2)
+        {
+            return 0;
+        }
+
+        /* 2 * cos(w) in Q14 is cos(w) in Q15 */
+        p_gz->coef[i] = adc_cos_q15(adc_phase_step(p_freq_mhz[i], rate_mhz));
+
+        /* sin^2(w) in Q30 is 1 - cos^2(w) */
+        if (4 * (int64_t)block_len * block_len >=
+            ((int64_t)1 << 30) - (int64_t)p_gz->coef[i] * p_gz->coef[i])
+        {
+            return 0;
+        }
+
+        p_gz->s1[i] = 0;
+        p_gz->s2[i] = 0;
+        p_gz->amplitude[i] = 0;
+    }
+
+    p_gz->dc_sum = 0;
+    p_gz->dc = 0;
+    p_gz->primed = 0;
+    p_gz->block_len = block_len;
+    p_gz->count = 0;
+    p_gz->num_tones = num_tones;
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_goertzel_add
+
+ Function Description:
+ @brief    Runs one sample through every resonator. At block end, the
+           amplitude of each tone is computed from its power
+           s1^2 + s2^2 - coef * s1 * s2 and the resonators restart.
+           The DC removed from each block is the mean of the previous one,
+           so the first block only seeds the mean and yields no result;
+           otherwise the full input offset would leak into the tones.
+
+ @param p_gz    Detector
+ @param x       Sample
+
+ @return 1 if a block was completed, 0 otherwise
+ */
+int adc_goertzel_add(adc_goertzel_t *p_gz, int16_t x)
+{
+    int32_t in = (int32_t)x - p_gz->dc;
+
+    if (p_gz->num_tones == 0)
+    {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < p_gz->num_tones; i++)
+    {
+        int64_t s0 = in + ((p_gz->coef[i] * p_gz->s1[i]) >> ADC_GOERTZEL_COEF_SHIFT)
+                     - p_gz->s2[i];
+
+        p_gz->s2[i] = p_gz->s1[i];
+        p_gz->s1[i] = s0;
+    }
+
+    p_gz->dc_sum += x;
+    if (++p_gz->count < p_gz->block_len)
+    {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < p_gz->num_tones; i++)
+    {
+        int64_t s1 = p_gz->s1[i];
+
+        if (!p_gz->primed)
+        {
+            p_gz->s1[i] = 0;
+            p_gz->s2[i] = 0;
+            continue;
+        }
+
+        int64_t s2 = p_gz->s2[i];
+        int64_t power = (s1 * s1) + (s2 * s2)
+                        - ((p_gz->coef[i] * s1 >> ADC_GOERTZEL_COEF_SHIFT) * s2);
+
+        /* Peak amplitude of a sinusoid is 2 * sqrt(power) / N */
+        p_gz->amplitude[i] = (2 * adc_isqrt64(power > 0 ? (uint64_t)power : 0)) /
+                             p_gz->block_len;
+        p_gz->s1[i] = 0;
+        p_gz->s2[i] = 0;
+    }
+
+    p_gz->dc = (int16_t)(p_gz->dc_sum / p_gz->block_len);
+    p_gz->dc_sum = 0;
+    p_gz->count = 0;
+
+    if (!p_gz->primed)
+    {
+        p_gz->primed = 1;
+        return 0;
+    }
+
+    return 1;
+}
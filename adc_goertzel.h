@@ -0,0 +1,95 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_goertzel.h
+ *
+ * @brief
+ *  Fixed-point Goertzel detector measuring the amplitude of a small set
+ *  of target frequencies over blocks of samples, e.g. mains hum or a
+ *  switching regulator leaking into an ADC input.
+ */
+
+#ifndef ADC_GOERTZEL_H
+#define ADC_GOERTZEL_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Maximum number of target frequencies per detector */
+#ifndef ADC_GOERTZEL_MAX_TONES
+#define ADC_GOERTZEL_MAX_TONES        4
+#endif
+
+/* Coefficients 2 * cos(w) are Q2.14 */
+#define ADC_GOERTZEL_COEF_SHIFT       14
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    int32_t  coef[ADC_GOERTZEL_MAX_TONES];    /* 2 * cos(w) per tone */
+    int64_t  s1[ADC_GOERTZEL_MAX_TONES];      /* Resonator state */
+    int64_t  s2[ADC_GOERTZEL_MAX_TONES];
+    uint32_t amplitude[ADC_GOERTZEL_MAX_TONES];   /* Result of the last block */
+    int32_t  dc_sum;                  /* Sum of the current block */
+    int16_t  dc;                      /* Mean of the previous block, removed from the input */
+    uint16_t block_len;               /* Samples per result */
+    uint16_t count;                   /* Samples in the current block */
+    uint8_t  num_tones;               /* 0 disables the detector */
+    uint8_t  primed;                  /* dc holds the mean of a full block */
+} adc_goertzel_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/*
+ * Configures num_tones target frequencies p_freq_mhz (in mHz) for a stream
+ * sampled at rate_mhz (in mHz). Returns 0 if a target is above half the
+ * sample rate, or if block_len is too long for the
+ * 64-bit power of a target (4 * block_len^2 must stay below sin^2(w) in Q30,
+ * e.g. about 9600 samples for a target at a tenth of the sample rate).
+ */
+int adc_goertzel_init(adc_goertzel_t *p_gz, const uint32_t *p_freq_mhz,
+                      uint8_t num_tones, uint32_t rate_mhz, uint16_t block_len);
+
+/*
+ * Adds a sample, returns 1 when a block completed and amplitude[] is updated.
+ * The first block only measures the DC offset and does not return 1.
+ */
+int adc_goertzel_add(adc_goertzel_t *p_gz, int16_t x);
+
+#endif /* ADC_GOERTZEL_H */
@@ -0,0 +1,198 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_hist.c
+ *
+ * @brief
+ *  Value histogram. Clamping to the first and last bucket uses sign
+ *  masks and the log2 index uses count-leading-zeros, so the update is
+ *  branch-free.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_hist.h"
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_hist_init
+
+ Function Description:
+ @brief    Computes the bucket layout and clears the counts.
+
+ @param p_hist         Histogram to be initialized
+ @param scale          Linear or log2 buckets
+ @param num_buckets    Number of buckets, 0 to disable
+ @param lo             Lowest value of interest
+ @param hi             Highest value of interest
+
+ @return 1 on success, 0 if the layout is not supported
+ */
+int adc_hist_init(adc_hist_t *p_hist, adc_hist_scale_t scale,
+                  uint8_t num_buckets, int16_t lo, int16_t hi)
+{
+    uint32_t range = (uint32_t)((int32_t)hi - lo) + 1;
+    uint32_t covered;
+
+    p_hist->num_buckets = 0;
+
+    if (num_buckets == 0)
+    {
+        return 1;
+    }
+    if ((num_buckets > ADC_HIST_MAX_BUCKETS) || (hi < lo))
+    {
+        return 0;
+    }
+
+    p_hist->lo = lo;
+    p_hist->scale = (uint8_t)scale;
+    p_hist->shift = 0;
+
+    /* Smallest power of two bucket unit that spans the range */
+    covered = (scale == ADC_HIST_LOG2) ? (1u << (num_buckets - 1)) : num_buckets;
+    while ((covered << p_hist->shift) < range)
+    {
+        p_hist->shift++;
+    }
+
+    p_hist->num_buckets = num_buckets;
+    adc_hist_clear(p_hist);
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_hist_process
+
+ Function Description:
+ @brief    Adds a run of samples to the histogram.
+
+ @param p_hist    Histogram
+ @param p_buf     Samples
+ @param count     Number of samples
+
+ @return void
+ */
+void adc_hist_process(adc_hist_t *p_hist, const int16_t *p_buf, uint16_t count)
+{
+    int32_t last = (int32_t)p_hist->num_buckets - 1;
+    int32_t lo = p_hist->lo;
+    uint8_t shift = p_hist->shift;
+    uint8_t is_log2 = (p_hist->scale == ADC_HIST_LOG2);
+
+    if (p_hist->num_buckets == 0)
+    {
+        return;
+    }
+
+    for (uint16_t n = 0; n < count; n++)
+    {
+        int32_t d = (int32_t)p_buf[n] - lo;
+        int32_t idx;
+        int32_t excess;
+
+        /* Below lo counts as lo */
+        d &= ~(d >> 31);
+        d >>= shift;
+
+        if (is_log2)
+        {
+            /* 0 -> 0, 1 -> 1, 2..3 -> 2, 4..7 -> 3, ... */
+            idx = 31 - __builtin_clz(((uint32_t)d << 1) | 1);
+        }
+        else
+        {
+            idx = d;
+        }
+
+        /* Above the last bucket counts as the last bucket */
+        excess = idx - last;
+        idx = last + (excess & (excess >> 31));
+
+        p_hist->counts[idx]++;
+    }
+
+    p_hist->total += count;
+}
+
+/*
+ Function name:
+ adc_hist_bucket_lo
+
+ Function Description:
+ @brief    Returns the lower edge of a bucket.
+
+ @param p_hist    Histogram
+ @param idx       Bucket index
+
+ @return lowest sample value counted in the bucket
+ */
+int32_t adc_hist_bucket_lo(const adc_hist_t *p_hist, uint8_t idx)
+{
+    int32_t offset = idx;
+
+    if ((p_hist->scale == ADC_HIST_LOG2) && (idx > 0))
+    {
+        offset = 1 << (idx - 1);
+    }
+
+    return p_hist->lo + (offset << p_hist->shift);
+}
+
+/*
+ Function name:
+ adc_hist_clear
+
+ Function Description:
+ @brief    Zeroes the counts.
+
+ @param p_hist    Histogram
+
+ @return void
+ */
+void adc_hist_clear(adc_hist_t *p_hist)
+{
+    for (uint8_t i = 0; i < ADC_HIST_MAX_BUCKETS; i++)
+    {
+        p_hist->counts[i] = 0;
+    }
+    p_hist->total = 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_hist.h
+ *
+ * @brief
+ *  Fixed layout value histogram with linear or log2 buckets. The bucket
+ *  of a sample is computed without branches, so an update costs the same
+ *  whatever the value.
+ */
+
+#ifndef ADC_HIST_H
+#define ADC_HIST_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Maximum number of buckets per histogram */
+#ifndef ADC_HIST_MAX_BUCKETS
+#define ADC_HIST_MAX_BUCKETS          16
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef enum
+{
+    ADC_HIST_LINEAR,                  /* Equal width buckets */
+    ADC_HIST_LOG2,                    /* Bucket k holds [2^(k-1), 2^k) above lo */
+} adc_hist_scale_t;
+
+typedef struct
+{
+    uint32_t counts[ADC_HIST_MAX_BUCKETS];
+    uint32_t total;                   /* Samples counted since the last clear */
+    int16_t  lo;                      /* Lower edge of the first bucket */
+    uint8_t  shift;                   /* Offsets from lo are divided by 2^shift */
+    uint8_t  num_buckets;             /* 0 disables the histogram */
+    uint8_t  scale;                   /* adc_hist_scale_t */
+} adc_hist_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/*
+ * Lays out num_buckets buckets covering at least lo..hi. Linear buckets are
+ * a power of two wide, so the covered range may extend past hi; samples
+ * outside the range land in the first or last bucket. Returns 0 if the
+ * layout is not supported.
+ */
+int adc_hist_init(adc_hist_t *p_hist, adc_hist_scale_t scale,
+                  uint8_t num_buckets, int16_t lo, int16_t hi);
+
+/* Counts count samples */
+void adc_hist_process(adc_hist_t *p_hist, const int16_t *p_buf, uint16_t count);
+
+/* Lower edge of bucket idx, in sample units */
+int32_t adc_hist_bucket_lo(const adc_hist_t *p_hist, uint8_t idx);
+
+/* Zeroes all buckets, the layout is kept */
+void adc_hist_clear(adc_hist_t *p_hist);
+
+#endif /* ADC_HIST_H */
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_jitter.c
+ *
+ * @brief
+ *  Scan timing instrumentation. The schedule is anchored on the first
+ *  scan and advanced by one period per scan, so lateness does not absorb
+ *  the delay of earlier scans. The timer and the timestamp clock run from
+ *  the same source; a scan that wakes early re-anchors the schedule.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_jitter.h"
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+static void adc_jitter_hist_add(adc_jitter_hist_t *p_hist, uint32_t value);
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_jitter_init
+
+ Function Description:
+ @brief    Sets the period and clears the statistics.
+
+ @param p_jit        Instrumentation state
+ @param period_us    Scheduled interval between scans
+
+ @return void
+ */
+void adc_jitter_init(adc_jitter_t *p_jit, uint32_t period_us)
+{
+    p_jit->period_us = period_us;
+    p_jit->due_us = 0;
+    p_jit->anchored = 0;
+    adc_jitter_clear(p_jit);
+}
+
+/*
+ Function name:
+ adc_jitter_start
+
+ Function Description:
+ @brief    Records the lateness of a scan. Whole periods of lateness are
+           scans the timer skipped, they are counted as missed and the
+           scan is matched to the latest slot it can serve.
+
+ @param p_jit     Instrumentation state
+ @param now_us    Wake time of the scan
+
+ @return now_us
+ */
+uint32_t adc_jitter_start(adc_jitter_t *p_jit, uint32_t now_us)
+{
+    uint32_t late;
+
+    if (!p_jit->anchored)
+    {
+        p_jit->due_us = now_us;
+        p_jit->anchored = 1;
+    }
+    else
+    {
+        p_jit->due_us += p_jit->period_us;
+    }
+
+    late = now_us - p_jit->due_us;
+
+    /* Woke before the schedule, the schedule is behind */
+    if ((int32_t)late < 0)
+    {
+        p_jit->due_us = now_us;
+        late = 0;
+    }
+
+    adc_jitter_hist_add(&p_jit->lateness, late);
+
+    while ((now_us - p_jit->due_us) >= p_jit->period_us)
+    {
+        p_jit->due_us += p_jit->period_us;
+        p_jit->missed++;
+    }
+
+    p_jit->scans++;
+
+    return now_us;
+}
+
+/*
+ Function name:
+ adc_jitter_end
+
+ Function Description:
+ @brief    Records the duration of a scan and whether it ran into the next
+           deadline.
+
+ @param p_jit       Instrumentation state
+ @param start_us    Wake time returned by adc_jitter_start
+ @param now_us      End time of the scan
+
+ @return void
+ */
+void adc_jitter_end(adc_jitter_t *p_jit, uint32_t start_us, uint32_t now_us)
+{
+    adc_jitter_hist_add(&p_jit->duration, now_us - start_us);
+
+    if ((now_us - p_jit->due_us) >= p_jit->period_us)
+    {
+        p_jit->overruns++;
+    }
+}
+
+/*
+ Function name:
+ adc_jitter_bucket_lo
+
+ Function Description:
+ @brief    Returns the lower edge of a bucket.
+
+ @param idx    Bucket index
+
+ @return smallest value counted in the bucket, in microseconds
+ */
+uint32_t adc_jitter_bucket_lo(uint8_t idx)
+{
+    return (idx == 0) ? 0 : (1u << (idx - 1));
+}
+
+/*
+ Function name:
+ adc_jitter_clear
+
+ Function Description:
+ @brief    Zeroes the histograms and counters.
+
+ @param p_jit    Instrumentation state
+
+ @return void
+ */
+void adc_jitter_clear(adc_jitter_t *p_jit)
+{
+    for (uint8_t i = 0; i < ADC_JITTER_BUCKETS; i++)
+    {
+        p_jit->lateness.counts[i] = 0;
+        p_jit->duration.counts[i] = 0;
+    }
+    p_jit->lateness.max_us = 0;
+    p_jit->duration.max_us = 0;
+    p_jit->scans = 0;
+    p_jit->missed = 0;
+    p_jit->overruns = 0;
+}
+
+/*
+ Function name:
+ adc_jitter_hist_add
+
+ Function Description:
+ @brief    Counts one value, the bucket is its bit length.
+
+ @param p_hist    Histogram
+ @param value     Value in microseconds
+
+ @return void
+ */
+static void adc_jitter_hist_add(adc_jitter_hist_t *p_hist, uint32_t value)
+{
+    /* 0 -> 0, 1 -> 1, 2..3 -> 2, 4..7 -> 3, ... */
+    uint32_t idx = (31 - __builtin_clz(value | 1)) + (value != 0);
+
+    if (idx >= ADC_JITTER_BUCKETS)
+    {
+        idx = ADC_JITTER_BUCKETS - 1;
+    }
+
+    p_hist->counts[idx]++;
+    if (value > p_hist->max_us)
+    {
+        p_hist->max_us = value;
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_jitter.h
+ *
+ * @brief
+ *  Timing instrumentation of a periodic scan. Every scan records how late
+ *  it woke up against its schedule and how long it ran, in log2 bucket
+ *  histograms, and counts the deadlines it missed.
+ */
+
+#ifndef ADC_JITTER_H
+#define ADC_JITTER_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Bucket k holds [2^(k-1), 2^k) us, the last one everything above */
+#define ADC_JITTER_BUCKETS            16
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t counts[ADC_JITTER_BUCKETS];
+    uint32_t max_us;                  /* Largest value counted */
+} adc_jitter_hist_t;
+
+typedef struct
+{
+    uint32_t period_us;               /* Scheduled interval between scans */
+    uint32_t due_us;                  /* Scheduled time of the scan in progress */
+    uint32_t scans;                   /* Scans since the last clear */
+    uint32_t missed;                  /* Scheduled scans that never ran */
+    uint32_t overruns;                /* Scans that ended after the next one was due */
+    uint8_t  anchored;                /* due_us holds a schedule */
+    adc_jitter_hist_t lateness;       /* Wake time minus scheduled time */
+    adc_jitter_hist_t duration;       /* Scan end minus wake time */
+} adc_jitter_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* Schedule starts at the first scan */
+void adc_jitter_init(adc_jitter_t *p_jit, uint32_t period_us);
+
+/* Call first thing in the scan, returns the wake time to pass to adc_jitter_end */
+uint32_t adc_jitter_start(adc_jitter_t *p_jit, uint32_t now_us);
+
+/* Call last thing in the scan */
+void adc_jitter_end(adc_jitter_t *p_jit, uint32_t start_us, uint32_t now_us);
+
+/* Lower edge of bucket idx in microseconds */
+uint32_t adc_jitter_bucket_lo(uint8_t idx);
+
+/* Zeroes the statistics, the schedule is kept */
+void adc_jitter_clear(adc_jitter_t *p_jit);
+
+#endif /* ADC_JITTER_H */
@@ -0,0 +1,423 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_median.c
+ *
+ * @brief
+ *  Streaming median based on a double heap with index tracking. The
+ *  sample leaving the window is overwritten in place by the arriving one
+ *  and then sifted, so no re-sort is ever needed.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_median.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Number of entries in the min-heap and max-heap, median excluded */
+#define MIN_CT(m)                     (((m)->ct - 1) / 2)
+#define MAX_CT(m)                     ((m)->ct / 2)
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+static void adc_mediator_init(adc_mediator_t *m, uint8_t size);
+static int adc_mediator_less(const adc_mediator_t *m, int i, int j);
+static int adc_mediator_cmp_exchange(adc_mediator_t *m, int i, int j);
+static void adc_mediator_min_sort_down(adc_mediator_t *m, int i);
+static void adc_mediator_max_sort_down(adc_mediator_t *m, int i);
+static int adc_mediator_min_sort_up(adc_mediator_t *m, int i);
+static int adc_mediator_max_sort_up(adc_mediator_t *m, int i);
+static void adc_mediator_insert(adc_mediator_t *m, int16_t v);
+static int16_t adc_mediator_median(const adc_mediator_t *m);
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_median_init
+
+ Function Description:
+ @brief    Configures the filter and empties its windows.
+
+ @param p_med          Filter to be initialized
+ @param window         Odd window length in 3..31, 0 to bypass
+ @param hampel_k_q8    Hampel threshold in MADs (Q8), 0 for plain median
+
+ @return 1 on success, 0 if the window length is not supported
+ */
+int adc_median_init(adc_median_t *p_med, uint8_t window, uint16_t hampel_k_q8)
+{
+    p_med->window = 0;
+    p_med->threshold_q8 = 0;
+    p_med->outliers = 0;
+
+    if (window == 0)
+    {
+        return 1;
+    }
+    if ((window < ADC_MEDIAN_MIN_WINDOW) || (window > ADC_MEDIAN_MAX_WINDOW) ||
+        ((window & 1) == 0))
+    {
+        return 0;
+    }
+
+    p_med->window = window;
+    p_med->threshold_q8 = ((uint32_t)hampel_k_q8 * ADC_MEDIAN_MAD_SCALE_Q8) >> 8;
+    adc_mediator_init(&p_med->value, window);
+    adc_mediator_init(&p_med->deviation, window);
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_median_process
+
+ Function Description:
+ @brief    Pushes each sample through the window and replaces it by the
+           median, either always or only when the Hampel identifier
+           flags it as an outlier.
+
+ @param p_med    Filter
+ @param p_buf    Samples, filtered in place
+ @param count    Number of samples
+
+ @return void
+ */
+void adc_median_process(adc_median_t *p_med, int16_t *p_buf, uint16_t count)
+{
+    if (p_med->window == 0)
+    {
+        return;
+    }
+
+    for (uint16_t n = 0; n < count; n++)
+    {
+        int16_t x = p_buf[n];
+        int16_t med;
+        uint32_t dev;
+        uint32_t mad;
+
+        adc_mediator_insert(&p_med->value, x);
+        med = adc_mediator_median(&p_med->value);
+
+        if (p_med->threshold_q8 == 0)
+        {
+            p_buf[n] = med;
+            continue;
+        }
+
+        dev = (x > med) ? (uint32_t)(x - med) : (uint32_t)(med - x);
+        adc_mediator_insert(&p_med->deviation, (int16_t)(dev > INT16_MAX ? INT16_MAX : dev));
+
+        /* Floor of one count so a flat signal does not flag every step */
+        mad = (uint32_t)adc_mediator_median(&p_med->deviation);
+        if (mad == 0)
+        {
+            mad = 1;
+        }
+
+        if (((uint64_t)dev << 8) > (uint64_t)p_med->threshold_q8 * mad)
+        {
+            p_buf[n] = med;
+            p_med->outliers++;
+        }
+    }
+}
+
+/*
+ Function name:
+ adc_mediator_init
+
+ Function Description:
+ @brief    Empties the window and lays out the heap positions of every
+           data slot, alternating between the min-heap and the max-heap.
+
+ @param m       Window
+ @param size    Odd window length
+
+ @return void
+ */
+static void adc_mediator_init(adc_mediator_t *m, uint8_t size)
+{
+    m->heap = &m->heap_buf[size / 2];
+    m->size = size;
+    m->idx = 0;
+    m->ct = 0;
+
+    for (int8_t i = (int8_t)size - 1; i >= 0; i--)
+    {
+        m->data[i] = 0;
+        m->pos[i] = (int8_t)(((i + 1) / 2) * ((i & 1) ? -1 : 1));
+        m->heap[m->pos[i]] = i;
+    }
+}
+
+/*
+ Function name:
+ adc_mediator_less
+
+ Function Description:
+ @brief    Compares the values at two heap positions.
+
+ @param m    Window
+ @param i    Heap position
+ @param j    Heap position
+
+ @return non-zero if the value at heap position i is less than at j
+ */
+static int adc_mediator_less(const adc_mediator_t *m, int i, int j)
+{
+    return m->data[m->heap[i]] < m->data[m->heap[j]];
+}
+
+/*
+ Function name:
+ adc_mediator_cmp_exchange
+
+ Function Description:
+ @brief    Swaps the entries at heap positions i and j if the value at i
+           is less than the value at j.
+
+ @param m    Window
+ @param i    Heap position
+ @param j    Heap position
+
+ @return non-zero if the entries were swapped
+ */
+static int adc_mediator_cmp_exchange(adc_mediator_t *m, int i, int j)
+{
+    int8_t t;
+
+    if (!adc_mediator_less(m, i, j))
+    {
+        return 0;
+    }
+
+    t = m->heap[i];
+    m->heap[i] = m->heap[j];
+    m->heap[j] = t;
+    m->pos[m->heap[i]] = (int8_t)i;
+    m->pos[m->heap[j]] = (int8_t)j;
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_mediator_min_sort_down
+
+ Function Description:
+ @brief    Sifts the min-heap entry at position i down towards the
+           leaves, swapping it with its smaller child.
+
+ @param m    Window
+ @param i    Heap position of the entry
+
+ @return void
+ */
+static void adc_mediator_min_sort_down(adc_mediator_t *m, int i)
+{
+    for (; i <= MIN_CT(m); i *= 2)
+    {
+        if ((i > 1) && (i < MIN_CT(m)) && adc_mediator_less(m, i + 1, i))
+        {
+            ++i;
+        }
+        if (!adc_mediator_cmp_exchange(m, i, i / 2))
+        {
+            break;
+        }
+    }
+}
+
+/*
+ Function name:
+ adc_mediator_max_sort_down
+
+ Function Description:
+ @brief    Sifts the max-heap entry at position i down towards the
+           leaves, swapping it with its larger child.
+
+ @param m    Window
+ @param i    Heap position of the entry
+
+ @return void
+ */
+static void adc_mediator_max_sort_down(adc_mediator_t *m, int i)
+{
+    for (; i >= -MAX_CT(m); i *= 2)
+    {
+        if ((i < -1) && (i > -MAX_CT(m)) && adc_mediator_less(m, i, i - 1))
+        {
+            --i;
+        }
+        if (!adc_mediator_cmp_exchange(m, i / 2, i))
+        {
+            break;
+        }
+    }
+}
+
+/*
+ Function name:
+ adc_mediator_min_sort_up
+
+ Function Description:
+ @brief    Sifts the min-heap entry at position i up towards the
+           median at position 0.
+
+ @param m    Window
+ @param i    Heap position of the entry
+
+ @return 1 if the entry became the median, 0 otherwise
+ */
+static int adc_mediator_min_sort_up(adc_mediator_t *m, int i)
+{
+    while ((i > 0) && adc_mediator_cmp_exchange(m, i, i / 2))
+    {
+        i /= 2;
+    }
+    return (i == 0);
+}
+
+/*
+ Function name:
+ adc_mediator_max_sort_up
+
+ Function Description:
+ @brief    Sifts the max-heap entry at position i up towards the
+           median at position 0.
+
+ @param m    Window
+ @param i    Heap position of the entry
+
+ @return 1 if the entry became the median, 0 otherwise
+ */
+static int adc_mediator_max_sort_up(adc_mediator_t *m, int i)
+{
+    while ((i < 0) && adc_mediator_cmp_exchange(m, i / 2, i))
+    {
+        i /= 2;
+    }
+    return (i == 0);
+}
+
+/*
+ Function name:
+ adc_mediator_insert
+
+ Function Description:
+ @brief    Replaces the oldest sample of the window by v and restores the
+           heap order from the slot's heap position.
+
+ @param m    Window
+ @param v    New sample
+
+ @return void
+ */
+static void adc_mediator_insert(adc_mediator_t *m, int16_t v)
+{
+    int is_new = (m->ct < m->size);
+    int p = m->pos[m->idx];
+    int16_t old = m->data[m->idx];
+
+    m->data[m->idx] = v;
+    m->idx = (uint8_t)((m->idx + 1 == m->size) ? 0 : m->idx + 1);
+    m->ct = (uint8_t)(m->ct + is_new);
+
+    if (p > 0)
+    {
+        if (!is_new && (old < v))
+        {
+            adc_mediator_min_sort_down(m, p * 2);
+        }
+        else if (adc_mediator_min_sort_up(m, p))
+        {
+            adc_mediator_max_sort_down(m, -1);
+        }
+    }
+    else if (p < 0)
+    {
+        if (!is_new && (v < old))
+        {
+            adc_mediator_max_sort_down(m, p * 2);
+        }
+        else if (adc_mediator_max_sort_up(m, p))
+        {
+            adc_mediator_min_sort_down(m, 1);
+        }
+    }
+    else
+    {
+        if (MAX_CT(m))
+        {
+            adc_mediator_max_sort_down(m, -1);
+        }
+        if (MIN_CT(m))
+        {
+            adc_mediator_min_sort_down(m, 1);
+        }
+    }
+}
+
+/*
+ Function name:
+ adc_mediator_median
+
+ Function Description:
+ @brief    Returns the median of the window. While the window fills up
+           with an even count, the mean of the two middle values.
+
+ @param m    Window
+
+ @return median of the samples in the window
+ */
+static int16_t adc_mediator_median(const adc_mediator_t *m)
+{
+    int32_t v = m->data[m->heap[0]];
+
+    if ((m->ct & 1) == 0)
+    {
+        v = (v + m->data[m->heap[-1]]) / 2;
+    }
+
+    return (int16_t)v;
+}
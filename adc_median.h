@@ -0,0 +1,99 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_median.h
+ *
+ * @brief
+ *  Streaming median filter and Hampel outlier rejector over a sliding
+ *  window of 3 to 31 samples. The window is kept as a max-heap and a
+ *  min-heap around the median, so each sample costs O(log window).
+ */
+
+#ifndef ADC_MEDIAN_H
+#define ADC_MEDIAN_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define ADC_MEDIAN_MIN_WINDOW         3
+#define ADC_MEDIAN_MAX_WINDOW         31
+
+/* 1.4826 in Q8, makes the MAD a consistent estimate of sigma */
+#define ADC_MEDIAN_MAD_SCALE_Q8       380
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/*
+ * Sliding window median. heap[0] is the median, heap[1..] the min-heap of
+ * larger values and heap[-1..] the max-heap of smaller values; heap points
+ * into the middle of heap_buf.
+ */
+typedef struct
+{
+    int16_t  data[ADC_MEDIAN_MAX_WINDOW];     /* Window in arrival order */
+    int8_t   pos[ADC_MEDIAN_MAX_WINDOW];      /* Heap position of each data slot */
+    int8_t   heap_buf[ADC_MEDIAN_MAX_WINDOW]; /* Data slot at each heap position */
+    int8_t  *heap;
+    uint8_t  size;                            /* Window length */
+    uint8_t  idx;                             /* Next data slot to overwrite */
+    uint8_t  ct;                              /* Samples in the window */
+} adc_mediator_t;
+
+typedef struct
+{
+    adc_mediator_t value;             /* Window of samples */
+    adc_mediator_t deviation;         /* Window of |sample - median| */
+    uint8_t        window;            /* 0 bypasses the filter */
+    uint32_t       threshold_q8;      /* Hampel k * 1.4826 in Q8, 0 for median mode */
+    uint32_t       outliers;          /* Samples replaced by the Hampel rejector */
+} adc_median_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/*
+ * window must be odd in 3..31, or 0 to bypass. With hampel_k_q8 == 0 every
+ * sample is replaced by the window median; otherwise only samples further
+ * than k scaled MADs from the median are replaced (Hampel identifier).
+ * Returns 0 if the window is not supported.
+ */
+int adc_median_init(adc_median_t *p_med, uint8_t window, uint16_t hampel_k_q8);
+
+/* Filters count samples in place */
+void adc_median_process(adc_median_t *p_med, int16_t *p_buf, uint16_t count);
+
+#endif /* ADC_MEDIAN_H */
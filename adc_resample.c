@@ -0,0 +1,261 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_resample.c
+ *
+ * @brief
+ *  Uniform grid resampler. Every input closes one interpolation segment;
+ *  the grid points inside it are interpolated with a Q15 position. The
+ *  position comes from one 32 bit division per segment and one
+ *  multiplication per grid point. Times are 32 bit microseconds and only
+ *  their differences are used, so wrap-around is harmless.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_resample.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define ADC_RESAMPLE_ONE              (1 << ADC_RESAMPLE_FRAC_BITS)
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+static int16_t adc_resample_point(const adc_resample_t *p_rs, int32_t xm1,
+                                  int32_t x0, int32_t x1, int32_t x2,
+                                  int32_t frac);
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_resample_init
+
+ Function Description:
+ @brief    Sets up the grid and clears the history.
+
+ @param p_rs         Resampler to be initialized
+ @param mode         Linear or cubic interpolation
+ @param period_us    Grid spacing in microseconds, 0 to bypass
+
+ @return void
+ */
+void adc_resample_init(adc_resample_t *p_rs, adc_resample_mode_t mode,
+                       uint32_t period_us)
+{
+    p_rs->period_us = period_us;
+    p_rs->mode = (uint8_t)mode;
+    p_rs->next_us = 0;
+    p_rs->count = 0;
+    p_rs->anchored = 0;
+    p_rs->regrids = 0;
+}
+
+/*
+ Function name:
+ adc_resample_point
+
+ Function Description:
+ @brief    Interpolates at position frac between x[1] and x[2]. Linear
+           mode ignores x[0] and x[3].
+
+ @param p_rs    Resampler
+ @param xm1     Sample before the segment
+ @param x0      Sample at the start of the segment
+ @param x1      Sample at the end of the segment
+ @param x2      Sample after the segment
+ @param frac    Position in the segment, Q15 in [0, 1)
+
+ @return interpolated value, saturated to 16 bits
+ */
+static int16_t adc_resample_point(const adc_resample_t *p_rs, int32_t xm1,
+                                  int32_t x0, int32_t x1, int32_t x2,
+                                  int32_t frac)
+{
+    int64_t y;
+
+    if (p_rs->mode == ADC_RESAMPLE_CUBIC)
+    {
+        /* ((a t + b) t + c) t / 2 + x0, Horner form of Catmull-Rom */
+        int64_t a = 3 * (x0 - x1) + x2 - xm1;
+        int64_t b = 2 * xm1 - 5 * x0 + 4 * x1 - x2;
+        int64_t c = x1 - xm1;
+
+        y = (a * frac) >> ADC_RESAMPLE_FRAC_BITS;
+        y = ((y + b) * frac) >> ADC_RESAMPLE_FRAC_BITS;
+        y = ((y + c) * frac + ADC_RESAMPLE_ONE) >> (ADC_RESAMPLE_FRAC_BITS + 1);
+        y += x0;
+    }
+    else
+    {
+        y = x0 + ((((int64_t)(x1 - x0) * frac) + (ADC_RESAMPLE_ONE >> 1)) >>
+                  ADC_RESAMPLE_FRAC_BITS);
+    }
+
+    if (y > INT16_MAX)
+    {
+        y = INT16_MAX;
+    }
+    if (y < INT16_MIN)
+    {
+        y = INT16_MIN;
+    }
+
+    return (int16_t)y;
+}
+
+/*
+ Function name:
+ adc_resample_add
+
+ Function Description:
+ @brief    Appends an input and interpolates the grid points of the
+           segment it closes. Linear mode closes the segment ending at
+           this input, cubic mode the one before it. If a segment holds
+           more grid points than fit in the output, the grid restarts at
+           the end of the segment.
+
+ @param p_rs       Resampler
+ @param t_us       Time of the input
+ @param x          Input value
+ @param p_out      Grid point values
+ @param max_out    Room in p_out
+
+ @return number of grid points written
+ */
+uint16_t adc_resample_add(adc_resample_t *p_rs, uint32_t t_us, int16_t x,
+                          int16_t *p_out, uint16_t max_out)
+{
+    uint32_t seg_start;
+    uint32_t seg_len;
+    uint32_t inv;
+    uint16_t n = 0;
+
+    if (p_rs->period_us == 0)
+    {
+        if (max_out == 0)
+        {
+            return 0;
+        }
+        p_out[0] = x;
+        return 1;
+    }
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        p_rs->t_us[i] = p_rs->t_us[i + 1];
+        p_rs->x[i] = p_rs->x[i + 1];
+    }
+    p_rs->t_us[3] = t_us;
+    p_rs->x[3] = x;
+
+    if (p_rs->count < 4)
+    {
+        p_rs->count++;
+    }
+
+    /* The segment is t_us[2]..t_us[3] in linear mode, one earlier in cubic */
+    if (p_rs->mode == ADC_RESAMPLE_CUBIC)
+    {
+        if (p_rs->count < 4)
+        {
+            return 0;
+        }
+        seg_start = p_rs->t_us[1];
+        seg_len = p_rs->t_us[2] - seg_start;
+    }
+    else
+    {
+        if (p_rs->count < 2)
+        {
+            return 0;
+        }
+        seg_start = p_rs->t_us[2];
+        seg_len = p_rs->t_us[3] - seg_start;
+    }
+
+    if (!p_rs->anchored)
+    {
+        p_rs->next_us = seg_start;
+        p_rs->anchored = 1;
+    }
+
+    if (seg_len == 0)
+    {
+        return 0;
+    }
+
+    /* Out of order input, keep the grid ahead of the segment */
+    if ((int32_t)(p_rs->next_us - seg_start) < 0)
+    {
+        p_rs->next_us = seg_start;
+    }
+
+    /* Q31 reciprocal of the segment length, positions are (dt * inv) >> 16 */
+    inv = 0x80000000u / seg_len;
+
+    while ((p_rs->next_us - seg_start) < seg_len)
+    {
+        int32_t frac;
+
+        if (n == max_out)
+        {
+            p_rs->next_us = seg_start + seg_len;
+            p_rs->regrids++;
+            break;
+        }
+
+        frac = (int32_t)(((uint64_t)(p_rs->next_us - seg_start) * inv) >> 16);
+
+        if (p_rs->mode == ADC_RESAMPLE_CUBIC)
+        {
+            p_out[n++] = adc_resample_point(p_rs, p_rs->x[0], p_rs->x[1],
+                                            p_rs->x[2], p_rs->x[3], frac);
+        }
+        else
+        {
+            p_out[n++] = adc_resample_point(p_rs, 0, p_rs->x[2], p_rs->x[3], 0,
+                                            frac);
+        }
+
+        p_rs->next_us += p_rs->period_us;
+    }
+
+    return n;
+}
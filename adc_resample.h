@@ -0,0 +1,90 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_resample.h
+ *
+ * @brief
+ *  Resampler from timestamped, unevenly spaced samples to a uniform time
+ *  grid, by linear or cubic (Catmull-Rom) interpolation in fixed point.
+ *  The state is the last four input samples.
+ */
+
+#ifndef ADC_RESAMPLE_H
+#define ADC_RESAMPLE_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Fractional bits of the interpolation position */
+#define ADC_RESAMPLE_FRAC_BITS        15
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef enum
+{
+    ADC_RESAMPLE_LINEAR,              /* Between the last two samples */
+    ADC_RESAMPLE_CUBIC,               /* Catmull-Rom over four samples, one sample later */
+} adc_resample_mode_t;
+
+typedef struct
+{
+    uint32_t period_us;               /* Grid spacing, 0 bypasses */
+    uint32_t next_us;                 /* Time of the next grid point */
+    uint32_t t_us[4];                 /* Times of the last inputs, oldest first */
+    int16_t  x[4];                    /* Last inputs, oldest first */
+    uint32_t regrids;                 /* Grid restarts after gaps or output overflow */
+    uint8_t  count;                   /* Valid inputs, up to 4 */
+    uint8_t  anchored;                /* next_us is on the grid */
+    uint8_t  mode;                    /* adc_resample_mode_t */
+} adc_resample_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* period_us of 0 bypasses the stage */
+void adc_resample_init(adc_resample_t *p_rs, adc_resample_mode_t mode,
+                       uint32_t period_us);
+
+/*
+ * Adds an input sample and writes the grid points it completes, at most
+ * max_out. Returns the number written; the last one is at next_us minus
+ * one period. Times must increase.
+ */
+uint16_t adc_resample_add(adc_resample_t *p_rs, uint32_t t_us, int16_t x,
+                          int16_t *p_out, uint16_t max_out);
+
+#endif /* ADC_RESAMPLE_H */
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_ring.c
+ *
+ * @brief
+ *  Single-producer/single-consumer ring buffer used to decouple ADC
+ *  sampling from conversion and output. The producer and consumer never
+ *  write the same index, so no lock or interrupt masking is required.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_ring.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define ADC_RING_MASK                 (ADC_RING_SIZE - 1)
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_ring_init
+
+ Function Description:
+ @brief    Empties the ring and clears its statistics. Must not be called
+           while either side is using the ring.
+
+ @param p_ring    Ring to be initialized
+
+ @return void
+ */
+void adc_ring_init(adc_ring_t *p_ring)
+{
+    p_ring->head = 0;
+    p_ring->tail = 0;
+    p_ring->drops = 0;
+    p_ring->high_watermark = 0;
+}
+
+/*
+ Function name:
+ adc_ring_push
+
+ Function Description:
+ @brief    Appends one sample. Called from the sampling context only.
+
+ @param p_ring          Ring to be written
+ @param timestamp_us    Time of the acquisition
+ @param raw             Signed raw sample value
+
+ @return 1 if the sample was stored, 0 if the ring was full
+ */
+int adc_ring_push(adc_ring_t *p_ring, uint32_t timestamp_us, int16_t raw)
+{
+    uint32_t head = p_ring->head;
+    uint32_t level = head - p_ring->tail;
+
+    if (level >= ADC_RING_SIZE)
+    {
+        p_ring->drops++;
+        return 0;
+    }
+
+    p_ring->samples[head & ADC_RING_MASK].timestamp_us = timestamp_us;
+    p_ring->samples[head & ADC_RING_MASK].raw = raw;
+
+    /* Sample must be visible before the consumer can see the new head */
+    ADC_RING_BARRIER();
+    p_ring->head = head + 1;
+
+    if (level + 1 > p_ring->high_watermark)
+    {
+        p_ring->high_watermark = level + 1;
+    }
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_ring_pop
+
+ Function Description:
+ @brief    Removes the oldest sample. Called from the consumer context only.
+
+ @param p_ring      Ring to be read
+ @param p_sample    Destination of the sample
+
+ @return 1 if a sample was read, 0 if the ring was empty
+ */
+int adc_ring_pop(adc_ring_t *p_ring, adc_sample_t *p_sample)
+{
+    uint32_t tail = p_ring->tail;
+
+    if (tail == p_ring->head)
+    {
+        return 0;
+    }
+
+    /* Read the slot only after the head that published it */
+    ADC_RING_BARRIER();
+    *p_sample = p_ring->samples[tail & ADC_RING_MASK];
+
+    /* Slot must be consumed before the producer may reuse it */
+    ADC_RING_BARRIER();
+    p_ring->tail = tail + 1;
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_ring_count
+
+ Function Description:
+ @brief    Returns the current fill level. Exact from the consumer side,
+           a lower bound from the producer side.
+
+ @param p_ring    Ring to be queried
+
+ @return number of samples waiting in the ring
+ */
+uint32_t adc_ring_count(const adc_ring_t *p_ring)
+{
+    return p_ring->head - p_ring->tail;
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_ring.h
+ *
+ * @brief
+ *  Single-producer/single-consumer lock-free ring buffer carrying
+ *  timestamped raw ADC samples from the sampling context to the
+ *  processing context. One ring is used per channel.
+ */
+
+#ifndef ADC_RING_H
+#define ADC_RING_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Number of samples held by each ring, must be a power of two */
+#ifndef ADC_RING_SIZE
+#define ADC_RING_SIZE                 64
+#endif
+
+#if (ADC_RING_SIZE & (ADC_RING_SIZE - 1)) != 0
+#error "ADC_RING_SIZE must be a power of two"
+#endif
+
+/*
+ * Orders the sample write/read against the index update. A full barrier is
+ * more than a single core needs, but keeps the ring correct on any target.
+ */
+#define ADC_RING_BARRIER()            __sync_synchronize()
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* One raw acquisition */
+typedef struct
+{
+    uint32_t timestamp_us;            /* Time of the acquisition */
+    int16_t  raw;                     /* Signed raw sample value */
+} adc_sample_t;
+
+/*
+ * head is only written by the producer and tail only by the consumer. Both
+ * are free running, so head - tail is the fill level even across wrap.
+ */
+typedef struct
+{
+    volatile uint32_t head;           /* Next slot to be written */
+    volatile uint32_t tail;           /* Next slot to be read */
+    uint32_t          drops;          /* Samples lost because ring was full */
+    uint32_t          high_watermark; /* Highest fill level seen by producer */
+    adc_sample_t      samples[ADC_RING_SIZE];
+} adc_ring_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+void adc_ring_init(adc_ring_t *p_ring);
+
+/* Producer side, returns 0 and counts a drop if the ring is full */
+int adc_ring_push(adc_ring_t *p_ring, uint32_t timestamp_us, int16_t raw);
+
+/* Consumer side, returns 0 if the ring is empty */
+int adc_ring_pop(adc_ring_t *p_ring, adc_sample_t *p_sample);
+
+/* Number of samples currently waiting in the ring */
+uint32_t adc_ring_count(const adc_ring_t *p_ring);
+
+#endif /* ADC_RING_H */
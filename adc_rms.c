@@ -0,0 +1,170 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_rms.c
+ *
+ * @brief
+ *  Windowed AC level detector. The variance about the mean is computed
+ *  at the end of the window as (n sum_sq - sum^2) / n^2, exact in 64 bit
+ *  integers for windows of up to 65535 samples.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_rms.h"
+#include "adc_stats.h"
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+static void adc_rms_reset(adc_rms_t *p_rms);
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_rms_reset
+
+ Function Description:
+ @brief    Starts a new window.
+
+ @param p_rms    Detector
+
+ @return void
+ */
+static void adc_rms_reset(adc_rms_t *p_rms)
+{
+    p_rms->count = 0;
+    p_rms->min = INT16_MAX;
+    p_rms->max = INT16_MIN;
+    p_rms->sum = 0;
+    p_rms->sum_sq = 0;
+}
+
+/*
+ Function name:
+ adc_rms_init
+
+ Function Description:
+ @brief    Sets the window length and starts the first window.
+
+ @param p_rms     Detector to be initialized
+ @param window    Samples per summary, 0 to disable
+
+ @return void
+ */
+void adc_rms_init(adc_rms_t *p_rms, uint16_t window)
+{
+    p_rms->window = window;
+    adc_rms_reset(p_rms);
+}
+
+/*
+ Function name:
+ adc_rms_add
+
+ Function Description:
+ @brief    Accumulates a sample and summarizes the window when it is
+           complete.
+
+ @param p_rms        Detector
+ @param x            Sample
+ @param p_summary    Filled in when a window is completed
+
+ @return 1 if a window has just been completed, 0 otherwise
+ */
+int adc_rms_add(adc_rms_t *p_rms, int16_t x, adc_rms_summary_t *p_summary)
+{
+    uint32_t n;
+    uint64_t spread;
+    uint64_t var_q16;
+    int32_t mean;
+    int32_t peak;
+
+    if (p_rms->window == 0)
+    {
+        return 0;
+    }
+
+    p_rms->sum += x;
+    p_rms->sum_sq += (uint64_t)((int32_t)x * x);
+    if (x < p_rms->min)
+    {
+        p_rms->min = x;
+    }
+    if (x > p_rms->max)
+    {
+        p_rms->max = x;
+    }
+
+    if (++p_rms->count < p_rms->window)
+    {
+        return 0;
+    }
+
+    n = p_rms->count;
+
+    /* n^2 var, never negative */
+    spread = (uint64_t)n * p_rms->sum_sq -
+             (uint64_t)((int64_t)p_rms->sum * p_rms->sum);
+    var_q16 = ((spread / n) << (2 * ADC_RMS_FRAC_BITS)) / n;
+
+    mean = (p_rms->sum >= 0) ? ((p_rms->sum + (int32_t)(n / 2)) / (int32_t)n) :
+                               ((p_rms->sum - (int32_t)(n / 2)) / (int32_t)n);
+    peak = p_rms->max - mean;
+    if ((mean - p_rms->min) > peak)
+    {
+        peak = mean - p_rms->min;
+    }
+
+    p_summary->count = (uint16_t)n;
+    p_summary->mean = (int16_t)mean;
+    p_summary->rms_q8 = adc_isqrt64(var_q16);
+    p_summary->peak = (uint16_t)peak;
+    p_summary->peak_to_peak = (uint16_t)(p_rms->max - p_rms->min);
+    p_summary->crest_q8 = 0;
+    if (p_summary->rms_q8 != 0)
+    {
+        p_summary->crest_q8 = (uint32_t)(((uint64_t)peak <<
+                                          (2 * ADC_RMS_FRAC_BITS)) /
+                                         p_summary->rms_q8);
+    }
+
+    adc_rms_reset(p_rms);
+
+    return 1;
+}
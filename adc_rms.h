@@ -0,0 +1,87 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_rms.h
+ *
+ * @brief
+ *  Windowed AC level detector: RMS about the window mean, peak deviation,
+ *  peak-to-peak and crest factor. Each sample only adds to a sum and a
+ *  64 bit sum of squares; the square root is taken once per window.
+ */
+
+#ifndef ADC_RMS_H
+#define ADC_RMS_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Fractional bits of the RMS and the crest factor */
+#define ADC_RMS_FRAC_BITS             8
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Summary of one completed window */
+typedef struct
+{
+    uint16_t count;                   /* Samples in the window */
+    int16_t  mean;                    /* DC level, rounded */
+    uint32_t rms_q8;                  /* RMS of the samples about the mean */
+    uint16_t peak;                    /* Largest deviation from the mean */
+    uint16_t peak_to_peak;            /* max - min */
+    uint32_t crest_q8;                /* peak / RMS, 0 for a flat window */
+} adc_rms_summary_t;
+
+typedef struct
+{
+    uint16_t window;                  /* Samples per summary, 0 disables */
+    uint16_t count;                   /* Samples accumulated so far */
+    int16_t  min;
+    int16_t  max;
+    int32_t  sum;                     /* Fits 65535 samples of full scale */
+    uint64_t sum_sq;                  /* Sum of squared samples */
+} adc_rms_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* window of 0 disables the detector */
+void adc_rms_init(adc_rms_t *p_rms, uint16_t window);
+
+/* Adds a sample, returns 1 and fills p_summary when it completed a window */
+int adc_rms_add(adc_rms_t *p_rms, int16_t x, adc_rms_summary_t *p_summary);
+
+#endif /* ADC_RMS_H */
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_stats.c
+ *
+ * @brief
+ *  Fixed-point Welford accumulator. The mean is kept with fractional
+ *  bits and the sum of squared deviations in 64 bits; the square root
+ *  is only taken when a window completes.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_stats.h"
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+static void adc_stats_reset(adc_stats_t *p_stats);
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_stats_init
+
+ Function Description:
+ @brief    Configures the window length and starts an empty window.
+
+ @param p_stats    Accumulator to be initialized
+ @param window     Samples per summary, 0 to disable
+
+ @return void
+ */
+void adc_stats_init(adc_stats_t *p_stats, uint16_t window)
+{
+    p_stats->window = window;
+    adc_stats_reset(p_stats);
+}
+
+/*
+ Function name:
+ adc_stats_add
+
+ Function Description:
+ @brief    Adds one sample to the window. When the window is full its
+           summary is computed and a new window is started.
+
+ @param p_stats      Accumulator
+ @param x            Sample
+ @param p_summary    Receives the summary of a completed window
+
+ @return 1 if a window was completed, 0 otherwise
+ */
+int adc_stats_add(adc_stats_t *p_stats, int16_t x, adc_stats_summary_t *p_summary)
+{
+    int32_t x_q8 = (int32_t)x << ADC_STATS_FRAC_BITS;
+    int32_t delta;
+    uint16_t n;
+
+    if (p_stats->window == 0)
+    {
+        return 0;
+    }
+
+    n = ++p_stats->count;
+
+    if ((n == 1) || (x < p_stats->min))
+    {
+        p_stats->min = x;
+    }
+    if ((n == 1) || (x > p_stats->max))
+    {
+        p_stats->max = x;
+    }
+
+    delta = x_q8 - p_stats->mean_q8;
+    p_stats->mean_q8 += delta / n;
+    p_stats->m2_q16 += (int64_t)delta * (x_q8 - p_stats->mean_q8);
+
+    if (n < p_stats->window)
+    {
+        return 0;
+    }
+
+    p_summary->count = n;
+    p_summary->min = p_stats->min;
+    p_summary->max = p_stats->max;
+    p_summary->mean_q8 = p_stats->mean_q8;
+    p_summary->variance_q16 = 0;
+    if ((n > 1) && (p_stats->m2_q16 > 0))
+    {
+        p_summary->variance_q16 = (uint64_t)p_stats->m2_q16 / (n - 1);
+    }
+    p_summary->stddev_q8 = adc_isqrt64(p_summary->variance_q16);
+
+    adc_stats_reset(p_stats);
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_isqrt64
+
+ Function Description:
+ @brief    Bitwise integer square root, one result bit per iteration.
+
+ @param val    Radicand
+
+ @return floor of the square root of val
+ */
+uint32_t adc_isqrt64(uint64_t val)
+{
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > val)
+    {
+        bit >>= 2;
+    }
+
+    while (bit != 0)
+    {
+        if (val >= res + bit)
+        {
+            val -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else
+        {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)res;
+}
+
+/*
+ Function name:
+ adc_stats_reset
+
+ Function Description:
+ @brief    Starts a new, empty window.
+
+ @param p_stats    Accumulator
+
+ @return void
+ */
+static void adc_stats_reset(adc_stats_t *p_stats)
+{
+    p_stats->count = 0;
+    p_stats->min = 0;
+    p_stats->max = 0;
+    p_stats->mean_q8 = 0;
+    p_stats->m2_q16 = 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_stats.h
+ *
+ * @brief
+ *  Windowed per-channel statistics (count, min, max, mean, variance)
+ *  accumulated with Welford's algorithm in fixed point, so a whole window
+ *  is summarized at O(1) cost per sample.
+ */
+
+#ifndef ADC_STATS_H
+#define ADC_STATS_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Fractional bits of the running mean */
+#define ADC_STATS_FRAC_BITS           8
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Summary of one completed window */
+typedef struct
+{
+    uint16_t count;                   /* Samples in the window */
+    int16_t  min;
+    int16_t  max;
+    int32_t  mean_q8;                 /* Mean with ADC_STATS_FRAC_BITS fraction */
+    uint64_t variance_q16;            /* Sample variance, 2 * ADC_STATS_FRAC_BITS fraction */
+    uint32_t stddev_q8;               /* Standard deviation, ADC_STATS_FRAC_BITS fraction */
+} adc_stats_summary_t;
+
+typedef struct
+{
+    uint16_t window;                  /* Samples per summary, 0 disables */
+    uint16_t count;                   /* Samples accumulated so far */
+    int16_t  min;
+    int16_t  max;
+    int32_t  mean_q8;                 /* Running mean */
+    int64_t  m2_q16;                  /* Running sum of squared deviations */
+} adc_stats_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+void adc_stats_init(adc_stats_t *p_stats, uint16_t window);
+
+/* Adds a sample, returns 1 and fills p_summary when it completed a window */
+int adc_stats_add(adc_stats_t *p_stats, int16_t x, adc_stats_summary_t *p_summary);
+
+/* Integer square root, floor(sqrt(val)) */
+uint32_t adc_isqrt64(uint64_t val);
+
+#endif /* ADC_STATS_H */
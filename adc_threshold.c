@@ -0,0 +1,144 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_threshold.c
+ *
+ * @brief
+ *  Threshold and window comparator. Leaving the window happens at the
+ *  thresholds, re-entering it requires moving hysteresis counts back
+ *  inside, so a noisy signal at a threshold does not chatter.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_threshold.h"
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_threshold_init
+
+ Function Description:
+ @brief    Configures the comparator. The zone is unknown until the
+           first sample.
+
+ @param p_thr         Comparator to be initialized
+ @param enabled       0 to disable the comparator
+ @param low           Low threshold
+ @param high          High threshold
+ @param hysteresis    Distance inside the window needed to re-enter it
+
+ @return 1 on success, 0 if the configuration is not valid
+ */
+int adc_threshold_init(adc_threshold_t *p_thr, uint8_t enabled,
+                       int16_t low, int16_t high, int16_t hysteresis)
+{
+    p_thr->enabled = 0;
+    p_thr->zone = ADC_THRESHOLD_NONE;
+
+    if (!enabled)
+    {
+        return 1;
+    }
+    if ((low > high) || (hysteresis < 0))
+    {
+        return 0;
+    }
+
+    p_thr->low = low;
+    p_thr->high = high;
+    p_thr->hysteresis = hysteresis;
+    p_thr->enabled = 1;
+
+    return 1;
+}
+
+/*
+ Function name:
+ adc_threshold_check
+
+ Function Description:
+ @brief    Updates the zone of the signal with one sample.
+
+ @param p_thr    Comparator
+ @param x        Sample
+
+ @return the new zone on a crossing, ADC_THRESHOLD_NONE otherwise
+ */
+adc_threshold_zone_t adc_threshold_check(adc_threshold_t *p_thr, int16_t x)
+{
+    int32_t val = x;
+    adc_threshold_zone_t zone;
+
+    if (!p_thr->enabled)
+    {
+        return ADC_THRESHOLD_NONE;
+    }
+
+    if (val > p_thr->high)
+    {
+        zone = ADC_THRESHOLD_ABOVE_HIGH;
+    }
+    else if (val < p_thr->low)
+    {
+        zone = ADC_THRESHOLD_BELOW_LOW;
+    }
+    else if ((p_thr->zone == ADC_THRESHOLD_ABOVE_HIGH) &&
+             (val > (int32_t)p_thr->high - p_thr->hysteresis))
+    {
+        zone = ADC_THRESHOLD_ABOVE_HIGH;
+    }
+    else if ((p_thr->zone == ADC_THRESHOLD_BELOW_LOW) &&
+             (val < (int32_t)p_thr->low + p_thr->hysteresis))
+    {
+        zone = ADC_THRESHOLD_BELOW_LOW;
+    }
+    else
+    {
+        zone = ADC_THRESHOLD_IN_WINDOW;
+    }
+
+    if (zone == p_thr->zone)
+    {
+        return ADC_THRESHOLD_NONE;
+    }
+
+    p_thr->zone = (uint8_t)zone;
+
+    return zone;
+}
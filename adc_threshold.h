@@ -0,0 +1,81 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_threshold.h
+ *
+ * @brief
+ *  Low/high threshold and window comparator with hysteresis. A sample
+ *  is classified as below the window, in the window or above it, and
+ *  only a change of class is reported.
+ */
+
+#ifndef ADC_THRESHOLD_H
+#define ADC_THRESHOLD_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef enum
+{
+    ADC_THRESHOLD_NONE,               /* No crossing */
+    ADC_THRESHOLD_BELOW_LOW,          /* Dropped below the low threshold */
+    ADC_THRESHOLD_IN_WINDOW,          /* Back between the thresholds */
+    ADC_THRESHOLD_ABOVE_HIGH,         /* Rose above the high threshold */
+} adc_threshold_zone_t;
+
+typedef struct
+{
+    int16_t low;                      /* INT16_MIN for a high threshold only */
+    int16_t high;                     /* INT16_MAX for a low threshold only */
+    int16_t hysteresis;               /* Distance to re-enter the window */
+    uint8_t zone;                     /* adc_threshold_zone_t, NONE until first sample */
+    uint8_t enabled;
+} adc_threshold_t;
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* Returns 0 if low > high or hysteresis is negative */
+int adc_threshold_init(adc_threshold_t *p_thr, uint8_t enabled,
+                       int16_t low, int16_t high, int16_t hysteresis);
+
+/*
+ * Classifies a sample. Returns the new zone if the sample crossed into it,
+ * including the zone of the very first sample, ADC_THRESHOLD_NONE otherwise.
+ */
+adc_threshold_zone_t adc_threshold_check(adc_threshold_t *p_thr, int16_t x);
+
+#endif /* ADC_THRESHOLD_H */
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_trig.c
+ *
+ * @brief
+ *  Quarter wave sine table with linear interpolation. Accurate to a few
+ *  Q15 counts, which is ample for filter and twiddle coefficients.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include "adc_trig.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define ADC_TRIG_QUARTER_BITS         6   /* 64 table steps per quarter turn */
+#define ADC_TRIG_FRAC_BITS            (14 - ADC_TRIG_QUARTER_BITS)
+
+/******************************************************************************
+ *                          Variables Definitions
+ ******************************************************************************/
+/* sin(i * pi / 128) in Q15, i = 0..64 */
+static const int16_t adc_trig_quarter_sine[(1 << ADC_TRIG_QUARTER_BITS) + 1] =
+{
+        0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+     6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767,
+};
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ adc_sin_q15
+
+ Function Description:
+ @brief    Sine of a phase, folded onto the first quarter turn.
+
+ @param phase    Angle, 65536 units per turn
+
+ @return sine in Q15
+ */
+int16_t adc_sin_q15(uint16_t phase)
+{
+    uint16_t quarter = phase >> 14;
+    uint16_t offset = phase & 0x3FFF;
+    uint16_t idx;
+    int32_t frac;
+    int32_t val;
+
+    /* Second and fourth quarters run the table backwards */
+    if (quarter & 1)
+    {
+        offset = 0x4000 - offset;
+    }
+
+    idx = offset >> ADC_TRIG_FRAC_BITS;
+    frac = offset & ((1 << ADC_TRIG_FRAC_BITS) - 1);
+    val = adc_trig_quarter_sine[idx];
+    if (idx < (1 << ADC_TRIG_QUARTER_BITS))
+    {
+        val += ((adc_trig_quarter_sine[idx + 1] - val) * frac) >> ADC_TRIG_FRAC_BITS;
+    }
+
+    /* Second half turn is negative */
+    return (int16_t)((quarter & 2) ? -val : val);
+}
+
+/*
+ Function name:
+ adc_cos_q15
+
+ Function Description:
+ @brief    Cosine of a phase, a quarter turn ahead of the sine.
+
+ @param phase    Angle, 65536 units per turn
+
+ @return cosine in Q15
+ */
+int16_t adc_cos_q15(uint16_t phase)
+{
+    return adc_sin_q15((uint16_t)(phase + 0x4000));
+}
+
+/*
+ Function name:
+ adc_phase_step
+
+ Function Description:
+ @brief    Converts a frequency into the phase advance per sample.
+
+ @param freq    Frequency
+ @param rate    Sample rate, in the same unit as freq
+
+ @return phase advance per sample, 65536 units per turn
+ */
+uint16_t adc_phase_step(uint32_t freq, uint32_t rate)
+{
+    if (rate == 0)
+    {
+        return 0;
+    }
+
+    return (uint16_t)(((uint64_t)freq << 16) / rate);
+}
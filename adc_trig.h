@@ -0,0 +1,59 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  adc_trig.h
+ *
+ * @brief
+ *  Fixed-point sine and cosine for configuring frequency domain stages.
+ *  A full turn is 65536 phase units; results are Q15.
+ */
+
+#ifndef ADC_TRIG_H
+#define ADC_TRIG_H
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                          Function Declarations
+ ******************************************************************************/
+/* sin(2 * pi * phase / 65536) in Q15 */
+int16_t adc_sin_q15(uint16_t phase);
+
+/* cos(2 * pi * phase / 65536) in Q15 */
+int16_t adc_cos_q15(uint16_t phase);
+
+/* Phase step of frequency freq at sample rate rate, same unit for both */
+uint16_t adc_phase_step(uint32_t freq, uint32_t rate);
+
+#endif /* ADC_TRIG_H */
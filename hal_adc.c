@@ -37,8 +37,10 @@
  * @brief
  *  This file contains the starting point of thermistor application.
  *  The application_start registers for Bluetooth stack in this file.
- *  This Wiced application initiates the HAL ADC drivers and reads the
- *  raw sample value and voltage once in every 5 seconds.
+ *  This Wiced application initiates the HAL ADC drivers and samples the
+ *  configured channels every APP_SAMPLE_PERIOD_MS. Samples are queued per
+ *  channel and the raw sample value and voltage are reported once in every
+ *  5 seconds.
  */
 
 /******************************************************************************
@@ -53,8 +55,28 @@
 #include "wiced_platform.h"
 #include "wiced_hal_puart.h"
 #include "wiced_timer.h"
+#include "wiced_rtos.h"
 #include "wiced_bt_stack.h"
 #include "wiced_platform.h"
+#include "clock_timer.h"
+#include "adc_ring.h"
+#include "adc_block.h"
+#include "adc_median.h"
+#include "adc_cic.h"
+#include "adc_biquad.h"
+#include "adc_ema.h"
+#include "adc_stats.h"
+#include "adc_hist.h"
+#include "adc_goertzel.h"
+#include "adc_fft.h"
+#include "adc_threshold.h"
+#include "adc_deadband.h"
+#include "adc_capture.h"
+#include "adc_jitter.h"
+#include "adc_resample.h"
+#include "adc_anomaly.h"
+#include "adc_rms.h"
+#include "adc_expr.h"
 
 /******************************************************************************
  *                                Constants
@@ -62,12 +84,86 @@
 /* Devices that support all ADC APIs currently */
 #define DEVICE_SUPPORTS_FULL_ADC_API  (defined(CYW20819) || defined(CYW20820))
 
-/* Number of samples to be taken for doing averaged filtering */
-#define AVG_NUM_OF_SAMPLES            3
+/*
+ * Number of samples to be taken for doing averaged filtering, per channel
+ * defaults. Noisy inputs average more, stable rails take a single read.
+ */
+#define AVG_NUM_OF_SAMPLES_NOISY      8
+#define AVG_NUM_OF_SAMPLES_STABLE     1
+
+/* EMA coefficient (1 / 2^shift) of the trend tracked on stable rails */
+#define EMA_SHIFT_STABLE              3
+
+/* Upper limit of the per-channel averaging count */
+#define AVG_NUM_OF_SAMPLES_MAX        32
+
+/*
+ * Approximate duration of one ADC conversion in DC measurement mode, used
+ * to budget the scan. Calibrate for the target device if it matters.
+ */
+#define ADC_CONVERSION_TIME_US        20
 
 /* Seconds timer (Timeout in seconds) */
 #define APP_TIMEOUT_IN_SECONDS        5
 
+/* Sampling timer (Period in milliseconds) */
+#define APP_SAMPLE_PERIOD_MS          100
+
+/* Sample rate of every channel in mHz */
+#define APP_SAMPLE_RATE_MHZ           (1000000000UL / APP_SAMPLE_PERIOD_MS)
+
+/* Samples per processing block (at most ADC_BLOCK_SIZE) */
+#define APP_BLOCK_SIZE                10
+
+/*
+ * Where conversion, filtering and output run: 1 for a worker thread, 0 for
+ * application event serialization, which also drains every sampling scan
+ * as soon as the application thread gets to it.
+ */
+#define APP_USE_WORKER_THREAD         1
+
+/* Report worker thread, it does all conversion, filtering and output */
+#define APP_WORKER_PRIORITY           PRIORITY_MEDIUM
+#define APP_WORKER_STACK_SIZE         2048
+#define APP_WORKER_QUEUE_DEPTH        3
+
+/* Requests to the report worker */
+#define APP_REQUEST_DRAIN             0
+#define APP_REQUEST_REPORT            1
+
+/* Scans between firmware reference readings, one per report */
+#define APP_FW_READING_SCANS          ((APP_TIMEOUT_IN_SECONDS * 1000) / APP_SAMPLE_PERIOD_MS)
+
+/* Set to 1 to sample ADC_INPUT_P0 - ADC_INPUT_P1, e.g. across a shunt */
+#define APP_SHUNT_PAIR                0
+
+/* Skew-minimized scan groups, and channels per group */
+#define APP_MAX_GROUPS                2
+#define APP_GROUP_MAX_CHANNELS        4
+
+/* Virtual channels computed from the others */
+#define APP_MAX_VIRTUAL               2
+
+/*
+ * Samples held by the burst capture buffer, sets the RAM used. A burst of
+ * that many samples of channel APP_BURST_CHANNEL is taken at start-up, and
+ * the first APP_BURST_DUMP_SAMPLES are displayed. 0 to disable.
+ */
+#define APP_BURST_MAX_SAMPLES         2048
+#define APP_BURST_CHANNEL             0
+#define APP_BURST_DUMP_SAMPLES        16
+
+/* Histograms are dumped every this many reports, 0 for on demand only */
+#define APP_HIST_DUMP_REPORTS         12
+
+/*
+ * A spectrum of APP_SPECTRUM_POINTS raw samples of channel
+ * APP_SPECTRUM_CHANNEL is captured every this many reports, 0 to disable
+ */
+#define APP_SPECTRUM_REPORTS          12
+#define APP_SPECTRUM_CHANNEL          0
+#define APP_SPECTRUM_POINTS           64
+
 /*
  * Macro function for debug log separators - readability
  * N represents the number of characters to be printed
@@ -82,9 +178,124 @@ WICED_BT_TRACE("\r\n");
 /* Stringizing the passed variable */
 #define GET_VARIABLE_NAME(x)  #x
 
+/* Number of entries in the channel table */
+#define ADC_APP_NUM_CHANNELS  (sizeof(adc_app_channels) / sizeof(adc_app_channels[0]))
+
+/* Channel of the virtual table entries, never an ADC input */
+#define ADC_APP_VIRTUAL_CHANNEL       ((ADC_INPUT_CHANNEL_SEL)0xFF)
+
+/* Non-zero if channel table entry ch_idx is computed, not sampled */
+#define ADC_APP_IS_VIRTUAL(ch_idx)    (adc_app_channels[ch_idx].channel == ADC_APP_VIRTUAL_CHANNEL)
+
 /******************************************************************************
  *                                Structures
  ******************************************************************************/
+/* How the readings of a channel are output */
+typedef enum
+{
+    ADC_APP_REPORT_PERIODIC,          /* Every APP_TIMEOUT_IN_SECONDS */
+    ADC_APP_REPORT_EVENTS,            /* Only threshold crossings */
+    ADC_APP_REPORT_DEADBAND,          /* Only changes beyond the deadband, and heartbeats */
+} adc_app_report_mode_t;
+
+/* ADC channel sampled by the application */
+typedef struct
+{
+    ADC_INPUT_CHANNEL_SEL channel;    /* ADC input to be sampled, ADC_APP_VIRTUAL_CHANNEL if computed */
+    UINT8                 differential;    /* Sample channel - channel_neg */
+    ADC_INPUT_CHANNEL_SEL channel_neg;     /* Negative input of a differential pair */
+    const adc_expr_op_t  *expr;       /* Virtual channel over ADC inputs, NULL for an input */
+    UINT8                 expr_len;   /* Operations in expr */
+    char*                 name;       /* Name used in the traces */
+    UINT8                 avg_samples;/* Default averaging count, unused if virtual */
+    UINT8                 group;      /* Scan group 1..APP_MAX_GROUPS, 0 for none */
+    UINT32                resample_period_us;  /* Uniform grid of the filters, 0 to bypass */
+    adc_resample_mode_t   resample_mode;   /* Linear or cubic interpolation */
+    UINT8                 median_window;   /* Odd median window, 0 to bypass */
+    UINT16                hampel_k_q8;     /* Hampel threshold in MADs, 0 for median */
+    UINT8                 cic_order;  /* CIC decimator stages, 0 to bypass */
+    UINT8                 cic_ratio_shift; /* log2 of the CIC decimation ratio */
+    UINT8                 cic_compensate;  /* Apply CIC droop compensation */
+    const adc_biquad_coef_t *biquad_coef;  /* Biquad cascade, NULL to bypass */
+    UINT8                 biquad_sections; /* Sections in biquad_coef */
+    adc_biquad_form_t     biquad_form;     /* DF1 or transposed DF2 */
+    UINT8                 ema_shift;       /* EMA coefficient 1 / 2^shift, 0 to bypass */
+    UINT16                stats_window;    /* Samples per statistics summary, 0 to disable */
+    UINT8                 hist_buckets;    /* Raw value histogram buckets, 0 to disable */
+    adc_hist_scale_t      hist_scale;      /* Linear or log2 buckets */
+    INT16                 hist_lo;         /* Raw range covered by the histogram */
+    INT16                 hist_hi;
+    const UINT32         *tone_freq_mhz;   /* Interference frequencies to detect, in mHz */
+    UINT8                 tone_count;      /* Entries in tone_freq_mhz, 0 to disable */
+    UINT16                tone_block_len;  /* Samples per tone measurement */
+    UINT16                tone_alarm;      /* Amplitude (raw) flagged as interference */
+    adc_app_report_mode_t report_mode;     /* Periodic or event driven output */
+    UINT8                 thresh_enabled;  /* Report raw threshold crossings */
+    INT16                 thresh_low;      /* Raw window, INT16_MIN/INT16_MAX for one side only */
+    INT16                 thresh_high;
+    INT16                 thresh_hysteresis;   /* Raw counts to re-enter the window */
+    UINT16                deadband;        /* Raw change reported in deadband mode */
+    UINT32                heartbeat_us;    /* Longest silence in deadband mode, 0 for none */
+    adc_capture_trigger_t capture_trigger; /* Pre-trigger capture condition, NONE to disable */
+    INT16                 capture_level;   /* Raw level of level and edge triggers */
+    INT16                 capture_slope;   /* Raw step of the slope trigger */
+    UINT16                capture_post;    /* Samples recorded after the trigger */
+    UINT8                 anomaly_shift;   /* Rolling window of 2^shift samples, 0 to disable */
+    UINT16                anomaly_k_q8;    /* z-score flagged as an anomaly, Q8 */
+    UINT16                anomaly_cooldown;    /* Samples without events after an anomaly */
+    UINT16                anomaly_min_sigma;   /* Raw noise floor of the z-score */
+    UINT16                rms_window;      /* Samples per RMS/peak summary, 0 to disable */
+} adc_app_channel_t;
+
+/* Processing state of one channel */
+typedef struct
+{
+    adc_ring_t     ring;              /* Queue from sample_timer */
+    adc_block_t    block;             /* Block assembled from the queue */
+    adc_resample_t resample;          /* Uniform time grid for the filters */
+    volatile UINT8 avg_samples;       /* Averaging count, may change any time */
+    adc_median_t   median;            /* Spike rejection on the raw samples */
+    adc_cic_t      cic;               /* Decimator applied to every block */
+    adc_biquad_t   biquad;            /* Low-pass after the decimator */
+    adc_ema_t      ema;               /* Trend of the filtered samples */
+    adc_stats_t    stats;             /* Windowed statistics of the output */
+    adc_hist_t     hist;              /* Distribution of the raw samples */
+    adc_goertzel_t tones;             /* Interference detector on the raw samples */
+    adc_threshold_t threshold;        /* Window comparator on the raw samples */
+    adc_deadband_t deadband;          /* Change suppression on the raw samples */
+    adc_capture_t  capture;           /* Pre-trigger capture of the raw samples */
+    adc_anomaly_t  anomaly;           /* Rolling z-score of the raw samples */
+    adc_rms_t      rms;               /* AC level of the raw samples */
+    UINT32         num_blocks;        /* Blocks processed so far */
+    INT16          block_mean;        /* Mean raw value of the last block */
+    UINT32         block_timestamp;   /* Time of the last sample of the block */
+    UINT32         drained;           /* Samples drained since the last report */
+    volatile UINT32 fw_mvolt;         /* Firmware reference reading, taken by the scan */
+    UINT64         last_time_us;      /* Time of the last drained sample, unwraps the ring time */
+    UINT8          grouped;           /* Acquired by its scan group */
+    UINT8          disabled;          /* Not sampled, left out of the reports */
+} adc_app_channel_state_t;
+
+/* Virtual channel expression compiled against the channel table */
+typedef struct
+{
+    UINT8          ch_idx;            /* Virtual channel in adc_app_channels */
+    UINT8          len;               /* Operations in prog */
+    UINT8          time_ch_idx;       /* Input whose sample time the result takes */
+    adc_expr_op_t  prog[ADC_EXPR_MAX_OPS];  /* Inputs are indices in adc_app_channels */
+} adc_app_virtual_t;
+
+/* Channels acquired back-to-back, and the skew between them */
+typedef struct
+{
+    UINT8          num_members;
+    UINT8          members[APP_GROUP_MAX_CHANNELS];  /* Indices in adc_app_channels */
+    UINT32         scans;             /* Group scans so far */
+    UINT32         skew_us;           /* First to last sample time of the last scan */
+    UINT32         skew_max_us;
+    UINT64         skew_sum_us;       /* For the mean skew */
+} adc_app_group_t;
+
 extern const wiced_bt_cfg_settings_t wiced_bt_cfg_settings;
 extern const wiced_bt_cfg_buf_pool_t wiced_bt_cfg_buf_pools[];
 
@@ -92,6 +303,129 @@ extern const wiced_bt_cfg_buf_pool_t wiced_bt_cfg_buf_pools[];
  *                                Variables Definitions
  ******************************************************************************/
 wiced_timer_t seconds_timer;                        /* Seconds timer instance */
+wiced_timer_t sample_timer;                         /* Sampling timer instance */
+static UINT32 report_count;                         /* Reports since start */
+static adc_jitter_t sample_timing;                  /* Timing of sample_timer scans */
+static adc_jitter_t report_timing;                  /* Timing of seconds_timer callbacks */
+static adc_jitter_t deferred_timing;                /* Timing of deferred reports */
+static adc_jitter_t drain_timing;                   /* Timing of drains */
+static UINT32 report_skips;                         /* Requests dropped, not posted */
+static volatile UINT32 drain_pending;               /* Scans waiting for the drain */
+static UINT32 drain_events;                         /* Drains run */
+static UINT32 drain_coalesced;                      /* Scans handled by an already pending drain */
+static UINT32 fw_reading_countdown;                 /* Scans to the next firmware reading */
+#if APP_USE_WORKER_THREAD
+static wiced_thread_t *report_worker;               /* Worker thread, NULL to report inline */
+static wiced_queue_t *report_queue;                 /* Drain and report requests to the worker */
+#endif
+
+#ifdef ADC_INPUT_VDDIO
+/* VDDIO / VDD_CORE in Q10, from inputs with the ground offset removed */
+static const adc_expr_op_t expr_rail_ratio[] =
+{
+    ADC_EXPR_IN(ADC_INPUT_VDDIO),
+    ADC_EXPR_K(10),
+    ADC_EXPR_OP(ADC_EXPR_SHL),
+    ADC_EXPR_IN(ADC_INPUT_VDD_CORE),
+    ADC_EXPR_OP(ADC_EXPR_DIV),
+};
+#endif
+
+/*
+ * Channels sampled on every tick of sample_timer, in scan order. Channels
+ * of a scan group are acquired together, ahead of the others. Virtual
+ * channels are computed from the inputs of the scan at its end.
+ */
+static const adc_app_channel_t adc_app_channels[] =
+{
+    {
+        .channel         = ADC_INPUT_P0,
+        .name            = GET_VARIABLE_NAME(ADC_INPUT_P0),
+        .avg_samples     = AVG_NUM_OF_SAMPLES_NOISY,
+        .resample_period_us = APP_SAMPLE_PERIOD_MS * 1000UL,
+        .resample_mode   = ADC_RESAMPLE_LINEAR,
+        .anomaly_shift   = 6,
+        .anomaly_k_q8    = 4 << 8,
+        .anomaly_cooldown = 50,
+        .anomaly_min_sigma = 4,
+        .rms_window      = 50,
+    },
+    {
+        .channel         = ADC_INPUT_ADC_BGREF,
+        .name            = GET_VARIABLE_NAME(ADC_INPUT_ADC_BGREF),
+        .avg_samples     = AVG_NUM_OF_SAMPLES_STABLE,
+        .ema_shift       = EMA_SHIFT_STABLE,
+    },
+#if APP_SHUNT_PAIR
+    {
+        .channel         = ADC_INPUT_P0,
+        .differential    = 1,
+        .channel_neg     = ADC_INPUT_P1,
+        .name            = GET_VARIABLE_NAME(ADC_INPUT_P0) "-"
+                           GET_VARIABLE_NAME(ADC_INPUT_P1),
+        .avg_samples     = AVG_NUM_OF_SAMPLES_NOISY,
+    },
+#endif
+#ifdef ADC_INPUT_VDDIO
+    {
+        .channel         = ADC_INPUT_VDDIO,
+        .name            = GET_VARIABLE_NAME(ADC_INPUT_VDDIO),
+        .avg_samples     = AVG_NUM_OF_SAMPLES_STABLE,
+        .group           = 1,
+        .ema_shift       = EMA_SHIFT_STABLE,
+    },
+#endif
+    {
+        .channel         = ADC_INPUT_VDD_CORE,
+        .name            = GET_VARIABLE_NAME(ADC_INPUT_VDD_CORE),
+        .avg_samples     = AVG_NUM_OF_SAMPLES_STABLE,
+        .group           = 1,
+        .ema_shift       = EMA_SHIFT_STABLE,
+    },
+#ifdef ADC_INPUT_VDDIO
+    {
+        .channel         = ADC_APP_VIRTUAL_CHANNEL,
+        .name            = "VDDIO/VDD_CORE(Q10)",
+        .expr            = expr_rail_ratio,
+        .expr_len        = sizeof(expr_rail_ratio) / sizeof(expr_rail_ratio[0]),
+        .ema_shift       = EMA_SHIFT_STABLE,
+    },
+#endif
+};
+
+/* Per-channel state, the rings run from sample_timer to seconds_timer */
+static adc_app_channel_state_t adc_app_state[ADC_APP_NUM_CHANNELS];
+
+/* Scan group g + 1 */
+static adc_app_group_t adc_app_groups[APP_MAX_GROUPS];
+
+/*
+ * Latest raw sample of every input, and its time, read by virtual channels.
+ * Single ended inputs are passed on with the ground offset removed.
+ */
+static INT16 scan_raw[ADC_APP_NUM_CHANNELS];
+static UINT32 scan_time[ADC_APP_NUM_CHANNELS];
+
+/* Virtual channels, in evaluation order */
+static adc_app_virtual_t adc_app_virtuals[APP_MAX_VIRTUAL];
+static UINT8 num_virtuals;
+
+/* Spectrum capture buffers, shared by all channels, one capture at a time */
+static INT16 spectrum_re[ADC_FFT_MAX_POINTS];
+static INT16 spectrum_im[ADC_FFT_MAX_POINTS];
+static UINT16 spectrum_mag[ADC_FFT_MAX_POINTS / 2];
+static UINT8 spectrum_ch_idx = 0xFF;                /* Capturing channel, 0xFF if idle */
+static UINT16 spectrum_points;                      /* Points requested */
+static UINT16 spectrum_count;                       /* Points captured so far */
+
+/* Burst capture */
+#if APP_BURST_MAX_SAMPLES
+static INT16 burst_buf[APP_BURST_MAX_SAMPLES];
+static UINT16 burst_count;                          /* Samples in burst_buf */
+static UINT8 burst_ch_idx;                          /* Channel of the burst */
+static UINT32 burst_start_us;                       /* Time before the first read */
+static UINT32 burst_end_us;                         /* Time after the last read */
+#endif
 
 /******************************************************************************
  *                          Function Declarations
@@ -102,10 +436,99 @@ sample_adc_app_management_cback(wiced_bt_management_evt_t event,
 
 static void seconds_app_timer_cb(uint32_t arg);
 
-static void adc_readings(ADC_INPUT_CHANNEL_SEL channel, char* channel_name);
+static void sample_app_timer_cb(uint32_t arg);
+
+#if APP_USE_WORKER_THREAD
+static void adc_app_start_worker(void);
+
+static void adc_app_worker(uint32_t arg);
+#else
+static int adc_app_report_event(void *p_data);
+#endif
+
+static void adc_app_defer_drain(void);
+
+static int adc_app_drain_event(void *p_data);
+
+static void adc_app_drain_all(void);
+
+static void adc_app_report_all(void);
+
+static void adc_readings(UINT8 ch_idx);
+
+static void adc_group_readings(adc_app_group_t *p_group);
+
+static INT16 adc_read_raw(UINT8 ch_idx);
+
+static void adc_app_init_groups(void);
+
+static void adc_virtual_readings(void);
+
+static void adc_fw_readings(void);
+
+static void adc_app_init_virtuals(void);
+
+static UINT8 adc_app_find_input(ADC_INPUT_CHANNEL_SEL channel);
+
+static void adc_drain(UINT8 ch_idx);
+
+static void adc_report(UINT8 ch_idx);
+
+static void adc_process_block(UINT8 ch_idx, const adc_block_t *p_block);
+
+static void adc_report_stats(UINT8 ch_idx, const adc_stats_summary_t *p_summary);
+
+static void adc_report_tones(UINT8 ch_idx);
+
+static void adc_report_threshold(UINT8 ch_idx, adc_threshold_zone_t zone,
+                                 UINT32 timestamp, INT16 raw);
+
+static void adc_report_change(UINT8 ch_idx, UINT32 timestamp, INT16 raw);
+
+static void adc_report_capture(UINT8 ch_idx);
+
+static void adc_report_anomaly(UINT8 ch_idx, UINT32 timestamp, INT16 raw);
+
+static void adc_rms_process(UINT8 ch_idx, const adc_block_t *p_block);
+
+static void adc_report_rms(UINT8 ch_idx, const adc_rms_summary_t *p_summary);
+
+static UINT32 adc_timestamp_us(void);
+
+UINT32 adc_app_set_averaging(UINT8 ch_idx, UINT8 avg_samples);
+
+static UINT32 adc_app_scan_time_us(void);
+
+void adc_app_dump_histograms(void);
+
+void adc_app_dump_timing(void);
+
+static void adc_dump_jitter(const char *name, const adc_jitter_t *p_jit);
+
+#if APP_SPECTRUM_REPORTS
+static wiced_result_t adc_app_capture_spectrum(UINT8 ch_idx, UINT16 points);
+#endif
+
+static void adc_spectrum_collect(UINT8 ch_idx, const adc_block_t *p_block);
+
+static void adc_spectrum_report(void);
+
+#if APP_BURST_MAX_SAMPLES
+static wiced_result_t adc_app_burst_capture(UINT8 ch_idx, UINT16 count);
+
+static void adc_app_dump_burst(UINT16 first, UINT16 count);
+#endif
+
+static UINT8 adc_app_conversions(UINT8 ch_idx);
+
+static INT16 adc_app_saturate(INT32 val);
 
 #if DEVICE_SUPPORTS_FULL_ADC_API
+static INT32 adc_app_raw_to_mvolt(UINT8 ch_idx, INT16 raw_val);
+
 static UINT32 convert_adc_raw_to_mvolt(INT16 raw_val);
+
+static INT32 convert_adc_diff_to_mvolt(INT16 diff_val);
 #endif
 
 /******************************************************************************
@@ -138,8 +561,9 @@ APPLICATION_START( )
     PRINT_N_ASTERISKS(70);
     WICED_BT_TRACE(
         "This application measures voltage on the selected DC channel\r\n"
-        "every 5 seconds(configurable) and displays both the raw\r\n"
-        "sample and converted voltage values via chosen UART.\r\n"
+        "every 100 milliseconds(configurable) and every 5 seconds\r\n"
+        "(configurable) displays both the raw sample and converted\r\n"
+        "voltage values via chosen UART.\r\n"
         );
     PRINT_N_ASTERISKS(70);
 
@@ -174,6 +598,134 @@ sample_adc_app_management_cback(wiced_bt_management_evt_t event,
         /* Initialize the necessary peripherals (ADC) */
         wiced_hal_adc_init();
 
+        adc_fft_init();
+
+        adc_jitter_init(&sample_timing, APP_SAMPLE_PERIOD_MS * 1000UL);
+        adc_jitter_init(&report_timing, APP_TIMEOUT_IN_SECONDS * 1000000UL);
+        adc_jitter_init(&deferred_timing, APP_TIMEOUT_IN_SECONDS * 1000000UL);
+        adc_jitter_init(&drain_timing, APP_SAMPLE_PERIOD_MS * 1000UL);
+
+        for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
+        {
+            adc_ring_init(&adc_app_state[i].ring);
+            adc_app_state[i].last_time_us = clock_SystemTimeMicroseconds64();
+            adc_block_init(&adc_app_state[i].block, APP_BLOCK_SIZE);
+            /* The EMA does the smoothing, one read per tick is enough */
+            adc_app_set_averaging(i, adc_app_channels[i].ema_shift ?
+                                     1 : adc_app_channels[i].avg_samples);
+            adc_ema_init(&adc_app_state[i].ema, adc_app_channels[i].ema_shift);
+            adc_stats_init(&adc_app_state[i].stats, adc_app_channels[i].stats_window);
+
+            if (!adc_hist_init(&adc_app_state[i].hist,
+                               adc_app_channels[i].hist_scale,
+                               adc_app_channels[i].hist_buckets,
+                               adc_app_channels[i].hist_lo,
+                               adc_app_channels[i].hist_hi))
+            {
+                WICED_BT_TRACE("Histogram layout of %s not supported\r\n",
+                               adc_app_channels[i].name);
+            }
+
+            if (!adc_goertzel_init(&adc_app_state[i].tones,
+                                   adc_app_channels[i].tone_freq_mhz,
+                                   adc_app_channels[i].tone_count,
+                                   APP_SAMPLE_RATE_MHZ,
+                                   adc_app_channels[i].tone_block_len))
+            {
+                WICED_BT_TRACE("Tone detection of %s not supported\r\n",
+                               adc_app_channels[i].name);
+            }
+
+            adc_rms_init(&adc_app_state[i].rms, adc_app_channels[i].rms_window);
+
+            if (!adc_anomaly_init(&adc_app_state[i].anomaly,
+                                  adc_app_channels[i].anomaly_shift,
+                                  adc_app_channels[i].anomaly_k_q8,
+                                  adc_app_channels[i].anomaly_cooldown,
+                                  adc_app_channels[i].anomaly_min_sigma))
+            {
+                WICED_BT_TRACE("Anomaly detector of %s not supported, disabled\r\n",
+                               adc_app_channels[i].name);
+            }
+
+            if (!adc_threshold_init(&adc_app_state[i].threshold,
+                                    adc_app_channels[i].thresh_enabled,
+                                    adc_app_channels[i].thresh_low,
+                                    adc_app_channels[i].thresh_high,
+                                    adc_app_channels[i].thresh_hysteresis))
+            {
+                WICED_BT_TRACE("Thresholds of %s not valid\r\n",
+                               adc_app_channels[i].name);
+            }
+
+            adc_deadband_init(&adc_app_state[i].deadband,
+                              adc_app_channels[i].report_mode == ADC_APP_REPORT_DEADBAND,
+                              adc_app_channels[i].deadband,
+                              adc_app_channels[i].heartbeat_us);
+
+            adc_capture_init(&adc_app_state[i].capture,
+                             adc_app_channels[i].capture_trigger,
+                             adc_app_channels[i].capture_level,
+                             adc_app_channels[i].capture_slope,
+                             adc_app_channels[i].capture_post);
+
+            adc_resample_init(&adc_app_state[i].resample,
+                              adc_app_channels[i].resample_mode,
+                              adc_app_channels[i].resample_period_us);
+
+            if (!adc_median_init(&adc_app_state[i].median,
+                                 adc_app_channels[i].median_window,
+                                 adc_app_channels[i].hampel_k_q8))
+            {
+                WICED_BT_TRACE("Median window of %s not supported, bypassed\r\n",
+                               adc_app_channels[i].name);
+            }
+
+            if (!adc_cic_init(&adc_app_state[i].cic,
+                              adc_app_channels[i].cic_order,
+                              adc_app_channels[i].cic_ratio_shift,
+                              adc_app_channels[i].cic_compensate))
+            {
+                WICED_BT_TRACE("CIC config of %s not supported, bypassed\r\n",
+                               adc_app_channels[i].name);
+            }
+
+            adc_biquad_init(&adc_app_state[i].biquad,
+                            adc_app_channels[i].biquad_coef,
+                            adc_app_channels[i].biquad_sections,
+                            adc_app_channels[i].biquad_form);
+        }
+
+        adc_app_init_groups();
+        adc_app_init_virtuals();
+
+        WICED_BT_TRACE("Scan acquisition time(in us) : %d\r\n",
+                       adc_app_scan_time_us());
+
+#if APP_BURST_MAX_SAMPLES
+        /* Nothing else converts yet, so the burst runs undisturbed */
+        if (adc_app_burst_capture(APP_BURST_CHANNEL, APP_BURST_MAX_SAMPLES) ==
+            WICED_SUCCESS)
+        {
+            adc_app_dump_burst(0, APP_BURST_DUMP_SAMPLES);
+        }
+#endif
+
+        /*
+         * Configure periodic sampling timer and start timer with
+         * APP_SAMPLE_PERIOD_MS
+         */
+        wiced_init_timer(&sample_timer,
+                         sample_app_timer_cb,
+                         0,
+                         WICED_MILLI_SECONDS_PERIODIC_TIMER);
+        wiced_start_timer(&sample_timer,
+                          APP_SAMPLE_PERIOD_MS);
+
+#if APP_USE_WORKER_THREAD
+        adc_app_start_worker();
+#endif
+
         /*
          * Configure seconds periodic timer and start timer with
          * APP_TIMEOUT_IN_SECONDS
@@ -200,6 +752,10 @@ sample_adc_app_management_cback(wiced_bt_management_evt_t event,
 
  Function Description:
  @brief    This callback function is invoked on timeout of seconds_timer.
+           It only asks the worker thread, or the application thread, for
+           a report, so conversion and output never run in the timer
+           context. Without a worker the report is done here. Samples are
+           drained after every scan, so a skipped report loses none.
 
  @param arg    unused argument
 
@@ -207,102 +763,1665 @@ sample_adc_app_management_cback(wiced_bt_management_evt_t event,
  */
 static void seconds_app_timer_cb(uint32_t arg)
 {
+    UINT32 start = adc_jitter_start(&report_timing, adc_timestamp_us());
+#if APP_USE_WORKER_THREAD
+    UINT32 request = APP_REQUEST_REPORT;
 
-    PRINT_N_ASTERISKS(70);
-
-    adc_readings(ADC_INPUT_P0, GET_VARIABLE_NAME(ADC_INPUT_P0));
-    adc_readings(ADC_INPUT_ADC_BGREF, GET_VARIABLE_NAME(ADC_INPUT_ADC_BGREF));
-    #ifdef ADC_INPUT_VDDIO
-    adc_readings(ADC_INPUT_VDDIO, GET_VARIABLE_NAME(ADC_INPUT_VDDIO));
-    #endif
-    adc_readings(ADC_INPUT_VDD_CORE, GET_VARIABLE_NAME(ADC_INPUT_VDD_CORE));
+    if (report_queue == NULL)
+    {
+        adc_app_report_all();
+    }
+    else if (wiced_rtos_push_to_queue(report_queue, &request, WICED_NO_WAIT) !=
+             WICED_SUCCESS)
+    {
+        report_skips++;
+    }
+#else
+    if (wiced_app_event_serialize(adc_app_report_event, NULL) != WICED_SUCCESS)
+    {
+        report_skips++;
+    }
+#endif
 
+    adc_jitter_end(&report_timing, start, adc_timestamp_us());
 }
 
+#if APP_USE_WORKER_THREAD
+/*
+ Function name:
+ adc_app_start_worker
+
+ Function Description:
+ @brief    This function creates the report queue and the worker thread
+           that serves it. On failure reports stay in the timer callback
+           and drains go to the application thread.
+
+ @return void
+ */
+static void adc_app_start_worker(void)
+{
+    report_queue = wiced_rtos_create_queue();
+    if ((report_queue == NULL) ||
+        (wiced_rtos_init_queue(report_queue, "adc_report", sizeof(UINT32),
+                               APP_WORKER_QUEUE_DEPTH) != WICED_SUCCESS))
+    {
+        WICED_BT_TRACE("Report queue failed, reporting from the timer\r\n");
+        report_queue = NULL;
+        return;
+    }
+
+    report_worker = wiced_rtos_create_thread();
+    if ((report_worker == NULL) ||
+        (wiced_rtos_init_thread(report_worker, APP_WORKER_PRIORITY, "adc_worker",
+                                adc_app_worker, APP_WORKER_STACK_SIZE,
+                                NULL) != WICED_SUCCESS))
+    {
+        WICED_BT_TRACE("Report worker failed, reporting from the timer\r\n");
+        wiced_rtos_deinit_queue(report_queue);
+        report_worker = NULL;
+        report_queue = NULL;
+    }
+}
 
 /*
  Function name:
- adc_readings
+ adc_app_worker
 
  Function Description:
- @brief    This function allows the user to get the ADC readings of the
-           particular channel that is passed.
+ @brief    Body of the worker thread. It waits for requests and runs
+           every drain and report.
 
- @param channel       ADC channel to be sampled
+ @param arg    unused argument
 
- @return void doesnt return anything
+ @return void
  */
-static void adc_readings(ADC_INPUT_CHANNEL_SEL channel, char* channel_name)
+static void adc_app_worker(uint32_t arg)
 {
+    UINT32 request;
 
-    UINT32 voltage_val = 0;
-    INT16 sign_raw_val = 0;
-#if DEVICE_SUPPORTS_FULL_ADC_API
-    INT16 conv_val = 0;
-#endif
+    while (1)
+    {
+        if (wiced_rtos_pop_from_queue(report_queue, &request, WICED_WAIT_FOREVER) !=
+            WICED_SUCCESS)
+        {
+            continue;
+        }
 
-    /*
-     * Measure the sample(raw and voltage values) on the channel being passed
-     * as an argument
-     */
-    voltage_val = wiced_hal_adc_read_voltage(channel);
-#if defined(CYW20706A2) || defined(CYW43012C0)
-    sign_raw_val = wiced_hal_adc_read_raw_sample(channel);
+        if (request == APP_REQUEST_DRAIN)
+        {
+            adc_app_drain_all();
+        }
+        else
+        {
+            UINT32 start = adc_jitter_start(&deferred_timing, adc_timestamp_us());
+
+            adc_app_report_all();
+            adc_jitter_end(&deferred_timing, start, adc_timestamp_us());
+        }
+    }
+}
 #else
-    sign_raw_val = wiced_hal_adc_read_raw_sample(channel, AVG_NUM_OF_SAMPLES);
-#endif
-#if DEVICE_SUPPORTS_FULL_ADC_API
-    conv_val = convert_adc_raw_to_mvolt(sign_raw_val);
+/*
+ Function name:
+ adc_app_report_event
+
+ Function Description:
+ @brief    Serialized event that runs a report.
+
+ @param p_data    unused
+
+ @return 0
+ */
+static int adc_app_report_event(void *p_data)
+{
+    UINT32 start = adc_jitter_start(&deferred_timing, adc_timestamp_us());
+
+    adc_app_report_all();
+    adc_jitter_end(&deferred_timing, start, adc_timestamp_us());
+
+    return 0;
+}
 #endif
 
-    WICED_BT_TRACE("ADC Channel: %s\r\n", channel_name);
+/*
+ Function name:
+ adc_app_defer_drain
 
-    WICED_BT_TRACE("Signed Raw Sample value\t\t\t\t: %d\r\n", sign_raw_val);
-    WICED_BT_TRACE("FW Voltage value(in mV)\t\t\t\t: %d\r\n", voltage_val);
-#if DEVICE_SUPPORTS_FULL_ADC_API
-    WICED_BT_TRACE("Voltage equivalent of received sample(in mV)\t: %d\r\n",
-                   conv_val);
+ Function Description:
+ @brief    This function asks the worker thread, or the application
+           thread, to drain the scan just taken. Scans taken while a drain
+           is pending are left to that drain, so one drain serves a whole
+           batch and the rings only have to hold the scans taken while
+           the consumer is busy.
+
+ @return void
+ */
+static void adc_app_defer_drain(void)
+{
+    wiced_result_t result;
+
+    if (__sync_fetch_and_add(&drain_pending, 1) != 0)
+    {
+        return;
+    }
+
+#if APP_USE_WORKER_THREAD
+    if (report_queue != NULL)
+    {
+        UINT32 request = APP_REQUEST_DRAIN;
+
+        result = wiced_rtos_push_to_queue(report_queue, &request, WICED_NO_WAIT);
+    }
+    else
 #endif
+    {
+        result = wiced_app_event_serialize(adc_app_drain_event, NULL);
+    }
 
-    WICED_BT_TRACE("\r\n");
+    /* Not posted, the next scan tries again */
+    if (result != WICED_SUCCESS)
+    {
+        drain_pending = 0;
+    }
+}
+
+/*
+ Function name:
+ adc_app_drain_event
+
+ Function Description:
+ @brief    Serialized event that drains the pending scans.
+
+ @param p_data    unused
 
+ @return 0
+ */
+static int adc_app_drain_event(void *p_data)
+{
+    adc_app_drain_all();
+
+    return 0;
 }
 
-#if DEVICE_SUPPORTS_FULL_ADC_API
 /*
  Function name:
- convert_adc_raw_to_mvolt
+ adc_app_drain_all
 
  Function Description:
- @brief    This function allows the user to convert a raw sample into
-           its equivalent voltage.
+ @brief    This function drains and processes every scan pending since
+           the drain was requested.
 
- @param raw_val    Sampled raw value from ADC
+ @return void
+ */
+static void adc_app_drain_all(void)
+{
+    UINT32 start = adc_jitter_start(&drain_timing, adc_timestamp_us());
+    UINT32 scans = __sync_lock_test_and_set(&drain_pending, 0);
 
- @return millivoltage equivalent of sampled raw value
+    drain_events++;
+    if (scans > 1)
+    {
+        drain_coalesced += scans - 1;
+    }
+
+    for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
+    {
+        adc_drain(i);
+    }
+
+    adc_jitter_end(&drain_timing, start, adc_timestamp_us());
+}
+
+/*
+ Function name:
+ adc_app_report_all
+
+ Function Description:
+ @brief    This function drains the samples queued since the previous
+           report, processes and reports them for every channel, and
+           transforms a completed spectrum capture. Every
+           APP_SPECTRUM_REPORTS reports it requests the next one.
+
+ @return void
  */
-static UINT32 convert_adc_raw_to_mvolt(INT16 raw_val)
+static void adc_app_report_all(void)
 {
-    INT32 mvolt = raw_val;
-    INT32 gnd_reading = wiced_hal_adc_get_ground_offset();
-    INT32 ref_reading = wiced_hal_adc_get_reference_reading();
-    UINT32 ref_mvolts = wiced_hal_adc_get_reference_micro_volts();
+    PRINT_N_ASTERISKS(70);
 
-    if (mvolt == 0)
+    adc_spectrum_report();
+
+    for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
     {
-        return 0;
+        if (!adc_app_state[i].disabled)
+        {
+            adc_report(i);
+        }
     }
 
-    if (mvolt < gnd_reading)
+    report_count++;
+#if APP_HIST_DUMP_REPORTS
+    if ((report_count % APP_HIST_DUMP_REPORTS) == 0)
     {
-        mvolt = gnd_reading;
+        adc_app_dump_histograms();
+        adc_app_dump_timing();
+    }
+#endif
+#if APP_SPECTRUM_REPORTS
+    if ((report_count % APP_SPECTRUM_REPORTS) == 0)
+    {
+        adc_app_capture_spectrum(APP_SPECTRUM_CHANNEL, APP_SPECTRUM_POINTS);
     }
+#endif
+}
 
-    mvolt -= gnd_reading;
-    mvolt *= ref_mvolts;
-    mvolt += ((ref_reading - gnd_reading) >> 1);           /* For rounding up */
-    mvolt /= (ref_reading - gnd_reading);
+/*
+ Function name:
+ sample_app_timer_cb
+
+ Function Description:
+ @brief    This callback function is invoked on timeout of sample_timer.
+           It only acquires, conversion and output are left to the
+           consumer so that they can not delay sampling.
+
+ @param arg    unused argument
+
+ @return void
+ */
+static void sample_app_timer_cb(uint32_t arg)
+{
+    UINT32 start = adc_jitter_start(&sample_timing, adc_timestamp_us());
+
+    for (UINT8 g = 0; g < APP_MAX_GROUPS; g++)
+    {
+        if (adc_app_groups[g].num_members != 0)
+        {
+            adc_group_readings(&adc_app_groups[g]);
+        }
+    }
+
+    for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
+    {
+        if (!adc_app_state[i].grouped && !ADC_APP_IS_VIRTUAL(i))
+        {
+            adc_readings(i);
+        }
+    }
+
+    adc_virtual_readings();
+
+    /* The consumer never converts, so the ADC is only used here and by bursts */
+    if (fw_reading_countdown-- == 0)
+    {
+        fw_reading_countdown = APP_FW_READING_SCANS - 1;
+        adc_fw_readings();
+    }
+
+    adc_app_defer_drain();
+
+    adc_jitter_end(&sample_timing, start, adc_timestamp_us());
+}
+
+
+/*
+ Function name:
+ adc_readings
+
+ Function Description:
+ @brief    This function takes one timestamped raw sample of the
+           particular channel that is passed and queues it for the
+           consumer. The timestamp is the middle of the acquisition,
+           including all averaged conversions.
+
+ @param ch_idx    Index of the channel in adc_app_channels
+
+ @return void doesnt return anything
+ */
+static void adc_readings(UINT8 ch_idx)
+{
+    UINT32 start = adc_timestamp_us();
+    UINT32 timestamp;
+    INT16 sign_raw_val = adc_read_raw(ch_idx);
+
+    timestamp = start + ((adc_timestamp_us() - start) >> 1);
+
+    scan_raw[ch_idx] = sign_raw_val;
+    scan_time[ch_idx] = timestamp;
+
+    /* A full ring is accounted for in its drop counter */
+    adc_ring_push(&adc_app_state[ch_idx].ring, timestamp, sign_raw_val);
+}
+
+/*
+ Function name:
+ adc_group_readings
+
+ Function Description:
+ @brief    This function acquires every channel of a scan group
+           back-to-back, with nothing but timestamps between the reads,
+           then queues the samples and records the skew between the
+           first and the last channel.
+
+ @param p_group    Scan group
+
+ @return void
+ */
+static void adc_group_readings(adc_app_group_t *p_group)
+{
+    INT16 raw[APP_GROUP_MAX_CHANNELS];
+    UINT32 edge[APP_GROUP_MAX_CHANNELS + 1];
+    UINT32 first = 0;
+    UINT32 timestamp = 0;
+
+    edge[0] = adc_timestamp_us();
+    for (UINT8 k = 0; k < p_group->num_members; k++)
+    {
+        raw[k] = adc_read_raw(p_group->members[k]);
+        edge[k + 1] = adc_timestamp_us();
+    }
+
+    for (UINT8 k = 0; k < p_group->num_members; k++)
+    {
+        timestamp = edge[k] + ((edge[k + 1] - edge[k]) >> 1);
+        if (k == 0)
+        {
+            first = timestamp;
+        }
+        scan_raw[p_group->members[k]] = raw[k];
+        scan_time[p_group->members[k]] = timestamp;
+        adc_ring_push(&adc_app_state[p_group->members[k]].ring, timestamp, raw[k]);
+    }
+
+    p_group->scans++;
+    p_group->skew_us = timestamp - first;
+    p_group->skew_sum_us += p_group->skew_us;
+    if (p_group->skew_us > p_group->skew_max_us)
+    {
+        p_group->skew_max_us = p_group->skew_us;
+    }
+}
+
+/*
+ Function name:
+ adc_read_raw
+
+ Function Description:
+ @brief    This function reads one averaged raw sample of the particular
+           channel that is passed. For a differential pair both inputs
+           are read back-to-back for every averaged sample and the
+           signed difference is returned.
+
+ @param ch_idx    Index of the channel in adc_app_channels
+
+ @return signed raw sample value
+ */
+static INT16 adc_read_raw(UINT8 ch_idx)
+{
+    ADC_INPUT_CHANNEL_SEL channel = adc_app_channels[ch_idx].channel;
+    UINT8 avg_samples = adc_app_state[ch_idx].avg_samples;
+
+    if (adc_app_channels[ch_idx].differential)
+    {
+        /* Interleaved so both inputs see the same moments */
+        ADC_INPUT_CHANNEL_SEL channel_neg = adc_app_channels[ch_idx].channel_neg;
+        INT32 diff = 0;
+
+        for (UINT8 i = 0; i < avg_samples; i++)
+        {
+#if defined(CYW20706A2) || defined(CYW43012C0)
+            diff += wiced_hal_adc_read_raw_sample(channel);
+            diff -= wiced_hal_adc_read_raw_sample(channel_neg);
+#else
+            diff += wiced_hal_adc_read_raw_sample(channel, 1);
+            diff -= wiced_hal_adc_read_raw_sample(channel_neg, 1);
+#endif
+        }
+        return adc_app_saturate(diff / avg_samples);
+    }
+
+#if defined(CYW20706A2) || defined(CYW43012C0)
+    /* No averaging in the driver, average in software instead */
+    INT32 sum = 0;
+    for (UINT8 i = 0; i < avg_samples; i++)
+    {
+        sum += wiced_hal_adc_read_raw_sample(channel);
+    }
+    return (INT16)(sum / avg_samples);
+#else
+    return wiced_hal_adc_read_raw_sample(channel, avg_samples);
+#endif
+}
+
+/*
+ Function name:
+ adc_app_init_groups
+
+ Function Description:
+ @brief    This function collects the channels of each scan group from
+           the channel table. Channels that do not fit a group are
+           scanned on their own.
+
+ @return void
+ */
+static void adc_app_init_groups(void)
+{
+    for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
+    {
+        UINT8 group = adc_app_channels[i].group;
+        adc_app_group_t *p_group;
+
+        if ((group == 0) || ADC_APP_IS_VIRTUAL(i))
+        {
+            continue;
+        }
+
+        if (group > APP_MAX_GROUPS)
+        {
+            WICED_BT_TRACE("Group of %s not supported, scanned alone\r\n",
+                           adc_app_channels[i].name);
+            continue;
+        }
+
+        p_group = &adc_app_groups[group - 1];
+        if (p_group->num_members == APP_GROUP_MAX_CHANNELS)
+        {
+            WICED_BT_TRACE("Group of %s full, scanned alone\r\n",
+                           adc_app_channels[i].name);
+            continue;
+        }
+
+        p_group->members[p_group->num_members++] = i;
+        adc_app_state[i].grouped = 1;
+    }
+}
+
+/*
+ Function name:
+ adc_virtual_readings
+
+ Function Description:
+ @brief    This function evaluates every virtual channel over the samples
+           of the scan just taken and queues the results like samples.
+           The ground offset is removed from single ended inputs first,
+           so that the inputs are proportional to their voltages and
+           ratios between them are ratios of voltages. Differential pairs
+           carry no offset and are passed on as they are.
+
+ @return void
+ */
+static void adc_virtual_readings(void)
+{
+    INT16 inputs[ADC_APP_NUM_CHANNELS];
+    INT32 gnd_reading = 0;
+
+    if (num_virtuals == 0)
+    {
+        return;
+    }
+
+#if DEVICE_SUPPORTS_FULL_ADC_API
+    gnd_reading = wiced_hal_adc_get_ground_offset();
+#endif
+    for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
+    {
+        inputs[i] = adc_app_channels[i].differential ? scan_raw[i] :
+                    adc_app_saturate((INT32)scan_raw[i] - gnd_reading);
+    }
+
+    for (UINT8 v = 0; v < num_virtuals; v++)
+    {
+        const adc_app_virtual_t *p_virt = &adc_app_virtuals[v];
+
+        adc_ring_push(&adc_app_state[p_virt->ch_idx].ring,
+                      scan_time[p_virt->time_ch_idx],
+                      adc_expr_eval(p_virt->prog, p_virt->len, inputs));
+    }
+}
+
+/*
+ Function name:
+ adc_fw_readings
+
+ Function Description:
+ @brief    This function takes the firmware reference reading of every
+           single ended channel for the next report. It runs in the
+           sampling scan, once per report period, so that only the
+           application thread starts conversions.
+
+ @return void
+ */
+static void adc_fw_readings(void)
+{
+    for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
+    {
+        if (!adc_app_channels[i].differential && !ADC_APP_IS_VIRTUAL(i))
+        {
+            adc_app_state[i].fw_mvolt =
+                wiced_hal_adc_read_voltage(adc_app_channels[i].channel);
+        }
+    }
+}
+
+/*
+ Function name:
+ adc_app_init_virtuals
+
+ Function Description:
+ @brief    This function compiles the expression of every virtual channel:
+           inputs named by ADC input are resolved to channel table
+           entries and the program is checked, so the scan only has to
+           evaluate it. Invalid virtual channels are disabled: they are
+           neither sampled nor reported.
+
+ @return void
+ */
+static void adc_app_init_virtuals(void)
+{
+    for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
+    {
+        const adc_app_channel_t *p_ch = &adc_app_channels[i];
+        adc_app_virtual_t *p_virt = &adc_app_virtuals[num_virtuals];
+        UINT8 valid;
+
+        if (!ADC_APP_IS_VIRTUAL(i))
+        {
+            continue;
+        }
+
+        if (num_virtuals == APP_MAX_VIRTUAL)
+        {
+            WICED_BT_TRACE("Too many virtual channels, %s not sampled\r\n",
+                           p_ch->name);
+            adc_app_state[i].disabled = 1;
+            continue;
+        }
+
+        valid = (p_ch->expr != NULL) && (p_ch->expr_len <= ADC_EXPR_MAX_OPS);
+        p_virt->time_ch_idx = 0xFF;
+        for (UINT8 k = 0; valid && (k < p_ch->expr_len); k++)
+        {
+            p_virt->prog[k] = p_ch->expr[k];
+            if (p_ch->expr[k].op == ADC_EXPR_INPUT)
+            {
+                UINT8 input = adc_app_find_input((ADC_INPUT_CHANNEL_SEL)p_ch->expr[k].arg);
+
+                valid = (input != 0xFF);
+                p_virt->prog[k].arg = input;
+                p_virt->time_ch_idx = input;
+            }
+        }
+
+        if (!valid || (p_virt->time_ch_idx == 0xFF) ||
+            !adc_expr_check(p_virt->prog, p_ch->expr_len, ADC_APP_NUM_CHANNELS))
+        {
+            WICED_BT_TRACE("Expression of %s not valid, not sampled\r\n",
+                           p_ch->name);
+            adc_app_state[i].disabled = 1;
+            continue;
+        }
+
+        p_virt->ch_idx = i;
+        p_virt->len = p_ch->expr_len;
+        num_virtuals++;
+    }
+}
+
+/*
+ Function name:
+ adc_app_find_input
+
+ Function Description:
+ @brief    This function looks up the single ended channel table entry of
+           an ADC input.
+
+ @param channel    ADC input
+
+ @return index in adc_app_channels, 0xFF if the input is not sampled
+ */
+static UINT8 adc_app_find_input(ADC_INPUT_CHANNEL_SEL channel)
+{
+    for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
+    {
+        if (!ADC_APP_IS_VIRTUAL(i) &&
+            !adc_app_channels[i].differential &&
+            (adc_app_channels[i].channel == channel))
+        {
+            return i;
+        }
+    }
+
+    return 0xFF;
+}
+
+/*
+ Function name:
+ adc_drain
+
+ Function Description:
+ @brief    This function drains the queued samples of the particular
+           channel that is passed into blocks and processes every
+           completed block.
+
+ @param ch_idx    Index of the channel in adc_app_channels
+
+ @return void doesnt return anything
+ */
+static void adc_drain(UINT8 ch_idx)
+{
+    adc_app_channel_state_t *p_state = &adc_app_state[ch_idx];
+    adc_sample_t sample;
+
+    while (adc_ring_pop(&p_state->ring, &sample))
+    {
+        p_state->drained++;
+
+        /* The ring carries the low 32 bits, far less than a wrap apart */
+        p_state->last_time_us += (UINT32)(sample.timestamp_us -
+                                          (UINT32)p_state->last_time_us);
+
+        if (adc_block_put(&p_state->block, p_state->last_time_us, sample.raw))
+        {
+            adc_process_block(ch_idx, &p_state->block);
+        }
+    }
+}
+
+/*
+ Function name:
+ adc_report
+
+ Function Description:
+ @brief    This function drains what is left of the queued samples of the
+           particular channel that is passed and, for a periodically
+           reported channel, displays the latest result along with the
+           queue statistics.
+
+ @param ch_idx    Index of the channel in adc_app_channels
+
+ @return void doesnt return anything
+ */
+static void adc_report(UINT8 ch_idx)
+{
+    adc_app_channel_state_t *p_state = &adc_app_state[ch_idx];
+    UINT32 num_samples;
+
+    adc_drain(ch_idx);
+    num_samples = p_state->drained;
+    p_state->drained = 0;
+
+    if (adc_app_channels[ch_idx].report_mode != ADC_APP_REPORT_PERIODIC)
+    {
+        return;
+    }
+
+    WICED_BT_TRACE("ADC Channel: %s\r\n", adc_app_channels[ch_idx].name);
+
+    /* Virtual channels do not convert, they are computed at scan end */
+    if (!ADC_APP_IS_VIRTUAL(ch_idx))
+    {
+        WICED_BT_TRACE("Averaged samples (acquisition time in us)\t: %d (%d)\r\n",
+                       p_state->avg_samples,
+                       p_state->avg_samples * adc_app_conversions(ch_idx) *
+                       ADC_CONVERSION_TIME_US);
+    }
+    WICED_BT_TRACE("Samples drained (dropped/high-watermark)\t: %d (%d/%d)\r\n",
+                   num_samples, p_state->ring.drops, p_state->ring.high_watermark);
+    WICED_BT_TRACE("Blocks processed\t\t\t\t: %d\r\n",
+                   p_state->num_blocks);
+    if (p_state->median.threshold_q8 != 0)
+    {
+        WICED_BT_TRACE("Outliers rejected\t\t\t\t: %d\r\n",
+                       p_state->median.outliers);
+    }
+    WICED_BT_TRACE("Last block timestamp(in us)\t\t\t: %u\r\n",
+                   p_state->block_timestamp);
+    WICED_BT_TRACE("Signed Raw Sample value(block mean)\t\t: %d\r\n",
+                   p_state->block_mean);
+    if (!adc_app_channels[ch_idx].differential && !ADC_APP_IS_VIRTUAL(ch_idx))
+    {
+        WICED_BT_TRACE("FW Voltage value(in mV)\t\t\t\t: %d\r\n", p_state->fw_mvolt);
+    }
+#if DEVICE_SUPPORTS_FULL_ADC_API
+    if (!ADC_APP_IS_VIRTUAL(ch_idx))
+    {
+        WICED_BT_TRACE("Voltage equivalent of received sample(in mV)\t: %d\r\n",
+                       adc_app_raw_to_mvolt(ch_idx, p_state->block_mean));
+    }
+#endif
+
+    WICED_BT_TRACE("\r\n");
+
+}
+
+/*
+ Function name:
+ adc_process_block
+
+ Function Description:
+ @brief    This function processes one completed block of the particular
+           channel that is passed as a whole. The raw samples are
+           interpolated onto the channel's uniform time grid in a work
+           buffer (or copied as they are), cleared of spikes by its median
+           stage, decimated by its CIC stage, low-pass filtered by its
+           biquad cascade and smoothed by its EMA, all in place. The
+           result feeds the channel's windowed statistics, while the raw
+           samples feed its histogram, its interference detector, its
+           threshold comparator, its anomaly detector, its deadband
+           reporting, its pre-trigger capture, its AC level detector and
+           a pending spectrum capture.
+
+ @param ch_idx     Index of the channel in adc_app_channels
+ @param p_block    Completed block of samples
+
+ @return void doesnt return anything
+ */
+static void adc_process_block(UINT8 ch_idx, const adc_block_t *p_block)
+{
+    adc_app_channel_state_t *p_state = &adc_app_state[ch_idx];
+    /* Jitter can put one more grid point than samples in a block */
+    INT16 work[2 * ADC_BLOCK_SIZE];
+    adc_stats_summary_t summary;
+    UINT16 count = 0;
+    INT32 sum = 0;
+
+    p_state->block_timestamp = (UINT32)adc_block_time_us(p_block, p_block->count - 1);
+    p_state->num_blocks++;
+
+    adc_hist_process(&p_state->hist, p_block->raw, p_block->count);
+
+    for (UINT16 i = 0; i < p_block->count; i++)
+    {
+        UINT32 timestamp = (UINT32)adc_block_time_us(p_block, i);
+        adc_threshold_zone_t zone;
+
+        if (adc_goertzel_add(&p_state->tones, p_block->raw[i]))
+        {
+            adc_report_tones(ch_idx);
+        }
+
+        zone = adc_threshold_check(&p_state->threshold, p_block->raw[i]);
+        if (zone != ADC_THRESHOLD_NONE)
+        {
+            adc_report_threshold(ch_idx, zone, timestamp,
+                                 p_block->raw[i]);
+        }
+
+        if (adc_anomaly_check(&p_state->anomaly, p_block->raw[i]))
+        {
+            adc_report_anomaly(ch_idx, timestamp, p_block->raw[i]);
+        }
+
+        if (adc_deadband_check(&p_state->deadband, p_block->raw[i],
+                               timestamp))
+        {
+            adc_report_change(ch_idx, timestamp, p_block->raw[i]);
+        }
+
+        if (adc_capture_add(&p_state->capture, timestamp,
+                            p_block->raw[i]))
+        {
+            adc_report_capture(ch_idx);
+        }
+    }
+
+    adc_rms_process(ch_idx, p_block);
+
+    if (spectrum_ch_idx == ch_idx)
+    {
+        adc_spectrum_collect(ch_idx, p_block);
+    }
+
+    for (UINT16 i = 0; i < p_block->count; i++)
+    {
+        count += adc_resample_add(&p_state->resample,
+                                  (UINT32)adc_block_time_us(p_block, i),
+                                  p_block->raw[i], &work[count],
+                                  (sizeof(work) / sizeof(work[0])) - count);
+    }
+
+    adc_median_process(&p_state->median, work, count);
+
+    count = adc_cic_process(&p_state->cic, work, work, count);
+    if (count == 0)
+    {
+        /* No grid point yet, or decimation ratio longer than the block */
+        return;
+    }
+
+    adc_biquad_process(&p_state->biquad, work, count);
+    adc_ema_process(&p_state->ema, work, count);
+
+    for (UINT16 i = 0; i < count; i++)
+    {
+        sum += work[i];
+
+        if (adc_stats_add(&p_state->stats, work[i], &summary))
+        {
+            adc_report_stats(ch_idx, &summary);
+        }
+    }
+
+    p_state->block_mean = (INT16)(sum / count);
+}
+
+/*
+ Function name:
+ adc_report_stats
+
+ Function Description:
+ @brief    This function displays the summary of one completed statistics
+           window of the particular channel that is passed.
+
+ @param ch_idx       Index of the channel in adc_app_channels
+ @param p_summary    Summary of the window
+
+ @return void doesnt return anything
+ */
+static void adc_report_stats(UINT8 ch_idx, const adc_stats_summary_t *p_summary)
+{
+    INT16 mean = (INT16)((p_summary->mean_q8 + (1 << (ADC_STATS_FRAC_BITS - 1))) >>
+                         ADC_STATS_FRAC_BITS);
+
+    WICED_BT_TRACE("ADC Channel: %s statistics over %d samples\r\n",
+                   adc_app_channels[ch_idx].name, p_summary->count);
+    WICED_BT_TRACE("Raw min/max/mean\t\t\t\t: %d/%d/%d\r\n",
+                   p_summary->min, p_summary->max, mean);
+    WICED_BT_TRACE("Raw standard deviation\t\t\t\t: %d.%02d\r\n",
+                   p_summary->stddev_q8 >> ADC_STATS_FRAC_BITS,
+                   ((p_summary->stddev_q8 & 0xFF) * 100) >> ADC_STATS_FRAC_BITS);
+#if DEVICE_SUPPORTS_FULL_ADC_API
+    /* Virtual channels are in the units of their expression */
+    if (!ADC_APP_IS_VIRTUAL(ch_idx))
+    {
+        WICED_BT_TRACE("Voltage equivalent of mean(in mV)\t\t: %d\r\n",
+                       adc_app_raw_to_mvolt(ch_idx, mean));
+    }
+#endif
+}
+
+/*
+ Function name:
+ adc_report_tones
+
+ Function Description:
+ @brief    This function displays the amplitude of every interference
+           frequency measured over the last tone block of the particular
+           channel that is passed, flagging those above the alarm level.
+
+ @param ch_idx    Index of the channel in adc_app_channels
+
+ @return void doesnt return anything
+ */
+static void adc_report_tones(UINT8 ch_idx)
+{
+    const adc_app_channel_t *p_cfg = &adc_app_channels[ch_idx];
+    const adc_goertzel_t *p_tones = &adc_app_state[ch_idx].tones;
+
+    for (UINT8 i = 0; i < p_tones->num_tones; i++)
+    {
+        WICED_BT_TRACE("ADC Channel: %s tone %d mHz amplitude(raw) : %d%s\r\n",
+                       p_cfg->name, p_cfg->tone_freq_mhz[i], p_tones->amplitude[i],
+                       (p_cfg->tone_alarm && (p_tones->amplitude[i] >= p_cfg->tone_alarm)) ?
+                       " INTERFERENCE" : "");
+    }
+}
+
+/*
+ Function name:
+ adc_report_threshold
+
+ Function Description:
+ @brief    This function displays one threshold crossing of the particular
+           channel that is passed.
+
+ @param ch_idx       Index of the channel in adc_app_channels
+ @param zone         Zone the signal crossed into
+ @param timestamp    Time of the sample that crossed
+ @param raw          Raw value of the sample that crossed
+
+ @return void doesnt return anything
+ */
+static void adc_report_threshold(UINT8 ch_idx, adc_threshold_zone_t zone,
+                                 UINT32 timestamp, INT16 raw)
+{
+    static const char* zone_names[] =
+    {
+        [ADC_THRESHOLD_BELOW_LOW]  = "below low threshold",
+        [ADC_THRESHOLD_IN_WINDOW]  = "in range",
+        [ADC_THRESHOLD_ABOVE_HIGH] = "above high threshold",
+    };
+
+#if DEVICE_SUPPORTS_FULL_ADC_API
+    if (!ADC_APP_IS_VIRTUAL(ch_idx))
+    {
+        WICED_BT_TRACE("ADC Channel: %s %s at %u us, raw %d (%d mV)\r\n",
+                       adc_app_channels[ch_idx].name, zone_names[zone], timestamp,
+                       raw, adc_app_raw_to_mvolt(ch_idx, raw));
+        return;
+    }
+#endif
+    WICED_BT_TRACE("ADC Channel: %s %s at %u us, raw %d\r\n",
+                   adc_app_channels[ch_idx].name, zone_names[zone], timestamp,
+                   raw);
+}
+
+/*
+ Function name:
+ adc_report_anomaly
+
+ Function Description:
+ @brief    This function displays an anomalous raw sample of the
+           particular channel that is passed, with its z-score against
+           the rolling statistics of the samples before it.
+
+ @param ch_idx       Index of the channel in adc_app_channels
+ @param timestamp    Time of the sample in microseconds
+ @param raw          Signed raw sample value
+
+ @return void doesnt return anything
+ */
+static void adc_report_anomaly(UINT8 ch_idx, UINT32 timestamp, INT16 raw)
+{
+    const adc_anomaly_t *p_an = &adc_app_state[ch_idx].anomaly;
+
+    WICED_BT_TRACE("ADC Channel: %s anomaly at %u us, raw %d, z %d.%02d "
+                   "(events/suppressed: %d/%d)\r\n",
+                   adc_app_channels[ch_idx].name, timestamp, raw,
+                   p_an->z_q8 >> 8, ((p_an->z_q8 & 0xFF) * 100) >> 8,
+                   p_an->events, p_an->suppressed);
+}
+
+/*
+ Function name:
+ adc_rms_process
+
+ Function Description:
+ @brief    This function feeds the raw samples of a block to the AC level
+           detector of the particular channel that is passed, and reports
+           every completed window.
+
+ @param ch_idx     Index of the channel in adc_app_channels
+ @param p_block    Completed block of samples
+
+ @return void doesnt return anything
+ */
+static void adc_rms_process(UINT8 ch_idx, const adc_block_t *p_block)
+{
+    adc_app_channel_state_t *p_state = &adc_app_state[ch_idx];
+    adc_rms_summary_t summary;
+
+    if (p_state->rms.window == 0)
+    {
+        return;
+    }
+
+    for (UINT16 i = 0; i < p_block->count; i++)
+    {
+        if (adc_rms_add(&p_state->rms, p_block->raw[i], &summary))
+        {
+            adc_report_rms(ch_idx, &summary);
+        }
+    }
+}
+
+/*
+ Function name:
+ adc_report_rms
+
+ Function Description:
+ @brief    This function displays the AC level of a completed window of
+           the particular channel that is passed.
+
+ @param ch_idx       Index of the channel in adc_app_channels
+ @param p_summary    Summary of the window
+
+ @return void doesnt return anything
+ */
+static void adc_report_rms(UINT8 ch_idx, const adc_rms_summary_t *p_summary)
+{
+    WICED_BT_TRACE("ADC Channel: %s AC level over %d samples\r\n",
+                   adc_app_channels[ch_idx].name, p_summary->count);
+    WICED_BT_TRACE("Raw RMS/peak/peak-to-peak\t\t\t: %d.%02d/%d/%d\r\n",
+                   p_summary->rms_q8 >> ADC_RMS_FRAC_BITS,
+                   ((p_summary->rms_q8 & 0xFF) * 100) >> ADC_RMS_FRAC_BITS,
+                   p_summary->peak, p_summary->peak_to_peak);
+    WICED_BT_TRACE("Crest factor (DC level)\t\t\t\t: %d.%02d (%d)\r\n",
+                   p_summary->crest_q8 >> ADC_RMS_FRAC_BITS,
+                   ((p_summary->crest_q8 & 0xFF) * 100) >> ADC_RMS_FRAC_BITS,
+                   p_summary->mean);
+}
+
+/*
+ Function name:
+ adc_report_change
+
+ Function Description:
+ @brief    This function displays a value of the particular channel that
+           is passed that moved beyond the deadband, or is due for a
+           heartbeat. Only reported values are converted.
+
+ @param ch_idx       Index of the channel in adc_app_channels
+ @param timestamp    Time of the sample
+ @param raw          Raw value of the sample
+
+ @return void doesnt return anything
+ */
+static void adc_report_change(UINT8 ch_idx, UINT32 timestamp, INT16 raw)
+{
+#if DEVICE_SUPPORTS_FULL_ADC_API
+    if (!ADC_APP_IS_VIRTUAL(ch_idx))
+    {
+        WICED_BT_TRACE("ADC Channel: %s at %u us, raw %d (%d mV), %d suppressed\r\n",
+                       adc_app_channels[ch_idx].name, timestamp, raw,
+                       adc_app_raw_to_mvolt(ch_idx, raw),
+                       adc_app_state[ch_idx].deadband.suppressed);
+        return;
+    }
+#endif
+    WICED_BT_TRACE("ADC Channel: %s at %u us, raw %d, %d suppressed\r\n",
+                   adc_app_channels[ch_idx].name, timestamp, raw,
+                   adc_app_state[ch_idx].deadband.suppressed);
+}
+
+/*
+ Function name:
+ adc_report_capture
+
+ Function Description:
+ @brief    This function ships the frozen pre-trigger capture window of
+           the particular channel that is passed, then re-arms the
+           capture.
+
+ @param ch_idx    Index of the channel in adc_app_channels
+
+ @return void doesnt return anything
+ */
+static void adc_report_capture(UINT8 ch_idx)
+{
+    adc_capture_t *p_cap = &adc_app_state[ch_idx].capture;
+    UINT16 num_samples = p_cap->pre_count + p_cap->post_count;
+
+    WICED_BT_TRACE("ADC Channel: %s capture, %d samples before trigger, %d from trigger\r\n",
+                   adc_app_channels[ch_idx].name, p_cap->pre_count, p_cap->post_count);
+
+    for (UINT16 i = 0; i < num_samples; i++)
+    {
+        UINT32 timestamp;
+        INT16 raw;
+
+        adc_capture_get(p_cap, i, &timestamp, &raw);
+        WICED_BT_TRACE("  %u us\t: %d%s\r\n", timestamp, raw,
+                       (i == p_cap->pre_count) ? " <- trigger" : "");
+    }
+
+    adc_capture_rearm(p_cap);
+}
+
+#if APP_SPECTRUM_REPORTS
+/*
+ Function name:
+ adc_app_capture_spectrum
+
+ Function Description:
+ @brief    This function requests the spectrum of the next points raw
+           samples of the particular channel that is passed. The burst is
+           collected by the drains and transformed by the next report, so
+           sampling scans and drains are not held up by the transform,
+           and the magnitude spectrum is displayed then. It is only called
+           by the report, which runs in the same thread as the drains: the
+           worker thread, or the application thread without one, so the
+           capture state needs no locking.
+
+ @param ch_idx    Index of the channel in adc_app_channels
+ @param points    Burst length, a power of two up to ADC_FFT_MAX_POINTS
+
+ @return WICED_SUCCESS if the capture was started, an error otherwise
+ */
+static wiced_result_t adc_app_capture_spectrum(UINT8 ch_idx, UINT16 points)
+{
+    if ((ch_idx >= ADC_APP_NUM_CHANNELS) || adc_app_state[ch_idx].disabled ||
+        (points < 2) || (points > ADC_FFT_MAX_POINTS) ||
+        ((points & (points - 1)) != 0))
+    {
+        return WICED_BADARG;
+    }
+
+    if (spectrum_ch_idx != 0xFF)
+    {
+        return WICED_ERROR;
+    }
+
+    spectrum_points = points;
+    spectrum_count = 0;
+    spectrum_ch_idx = ch_idx;
+
+    return WICED_SUCCESS;
+}
+#endif
+
+/*
+ Function name:
+ adc_spectrum_collect
+
+ Function Description:
+ @brief    This function copies raw samples of a block into the spectrum
+           capture, until the burst is complete.
+
+ @param ch_idx     Index of the capturing channel in adc_app_channels
+ @param p_block    Completed block of samples
+
+ @return void doesnt return anything
+ */
+static void adc_spectrum_collect(UINT8 ch_idx, const adc_block_t *p_block)
+{
+    for (UINT16 i = 0; (i < p_block->count) && (spectrum_count < spectrum_points); i++)
+    {
+        spectrum_re[spectrum_count] = p_block->raw[i];
+        spectrum_im[spectrum_count] = 0;
+        spectrum_count++;
+    }
+}
+
+/*
+ Function name:
+ adc_spectrum_report
+
+ Function Description:
+ @brief    This function transforms a complete spectrum capture and
+           displays the magnitude of every bin. It runs from the report,
+           not from the drains: with APP_USE_WORKER_THREAD 0 both run in
+           the application thread, and a drain must stay short to let the
+           next sampling scan run on time.
+
+ @return void doesnt return anything
+ */
+static void adc_spectrum_report(void)
+{
+    UINT8 ch_idx = spectrum_ch_idx;
+
+    if ((ch_idx == 0xFF) || (spectrum_count < spectrum_points))
+    {
+        return;
+    }
+
+    adc_fft_q15(spectrum_re, spectrum_im, spectrum_points);
+    adc_fft_magnitude(spectrum_re, spectrum_im, spectrum_points, spectrum_mag);
+
+    WICED_BT_TRACE("ADC Channel: %s spectrum of %d samples, magnitude(raw)\r\n",
+                   adc_app_channels[ch_idx].name, spectrum_points);
+    for (UINT16 k = 0; k < spectrum_points / 2; k++)
+    {
+        WICED_BT_TRACE("  %d mHz\t: %d\r\n",
+                       (UINT32)(((UINT64)APP_SAMPLE_RATE_MHZ * k) / spectrum_points),
+                       spectrum_mag[k]);
+    }
+
+    spectrum_ch_idx = 0xFF;
+}
+
+#if APP_BURST_MAX_SAMPLES
+/*
+ Function name:
+ adc_app_burst_capture
+
+ Function Description:
+ @brief    This function reads count raw samples of the particular channel
+           that is passed back-to-back, as fast as the ADC converts, into
+           the burst buffer. Nothing but the reads runs in the loop; the
+           achieved rate and a summary are displayed afterwards, and the
+           samples can be displayed with adc_app_dump_burst(). The caller
+           is blocked for the whole burst and sampling scans are held off,
+           so it is called at start-up, before the sampling timer starts,
+           from the application thread where all ADC conversions are
+           started: bursts and scans can not interleave.
+
+ @param ch_idx    Index of the channel in adc_app_channels
+ @param count     Samples to capture, 1..APP_BURST_MAX_SAMPLES
+
+ @return WICED_SUCCESS, or WICED_BADARG for an invalid request
+ */
+static wiced_result_t adc_app_burst_capture(UINT8 ch_idx, UINT16 count)
+{
+    ADC_INPUT_CHANNEL_SEL channel;
+    ADC_INPUT_CHANNEL_SEL channel_neg;
+    UINT32 elapsed;
+    INT32 sum = 0;
+    INT16 min_raw = INT16_MAX;
+    INT16 max_raw = INT16_MIN;
+
+    if ((ch_idx >= ADC_APP_NUM_CHANNELS) || (count == 0) ||
+        (count > APP_BURST_MAX_SAMPLES) || ADC_APP_IS_VIRTUAL(ch_idx))
+    {
+        return WICED_BADARG;
+    }
+
+    channel = adc_app_channels[ch_idx].channel;
+    channel_neg = adc_app_channels[ch_idx].channel_neg;
+
+    burst_start_us = adc_timestamp_us();
+    if (adc_app_channels[ch_idx].differential)
+    {
+        for (UINT16 n = 0; n < count; n++)
+        {
+#if defined(CYW20706A2) || defined(CYW43012C0)
+            burst_buf[n] = adc_app_saturate((INT32)wiced_hal_adc_read_raw_sample(channel) -
+                                            wiced_hal_adc_read_raw_sample(channel_neg));
+#else
+            burst_buf[n] = adc_app_saturate((INT32)wiced_hal_adc_read_raw_sample(channel, 1) -
+                                            wiced_hal_adc_read_raw_sample(channel_neg, 1));
+#endif
+        }
+    }
+    else
+    {
+        for (UINT16 n = 0; n < count; n++)
+        {
+#if defined(CYW20706A2) || defined(CYW43012C0)
+            burst_buf[n] = wiced_hal_adc_read_raw_sample(channel);
+#else
+            burst_buf[n] = wiced_hal_adc_read_raw_sample(channel, 1);
+#endif
+        }
+    }
+    burst_end_us = adc_timestamp_us();
+
+    burst_ch_idx = ch_idx;
+    burst_count = count;
+
+    for (UINT16 n = 0; n < count; n++)
+    {
+        sum += burst_buf[n];
+        if (burst_buf[n] < min_raw)
+        {
+            min_raw = burst_buf[n];
+        }
+        if (burst_buf[n] > max_raw)
+        {
+            max_raw = burst_buf[n];
+        }
+    }
+
+    elapsed = burst_end_us - burst_start_us;
+    if (elapsed == 0)
+    {
+        elapsed = 1;
+    }
+
+    WICED_BT_TRACE("ADC Channel: %s burst of %d samples in %d us\r\n",
+                   adc_app_channels[ch_idx].name, count, elapsed);
+    WICED_BT_TRACE("Sample rate(in Hz)\t\t\t\t: %d\r\n",
+                   (UINT32)(((UINT64)count * 1000000UL) / elapsed));
+    WICED_BT_TRACE("Raw min/mean/max\t\t\t\t: %d/%d/%d\r\n",
+                   min_raw, (INT16)(sum / count), max_raw);
+#if DEVICE_SUPPORTS_FULL_ADC_API
+    WICED_BT_TRACE("Voltage min/mean/max(in mV)\t\t\t: %d/%d/%d\r\n",
+                   adc_app_raw_to_mvolt(ch_idx, min_raw),
+                   adc_app_raw_to_mvolt(ch_idx, (INT16)(sum / count)),
+                   adc_app_raw_to_mvolt(ch_idx, max_raw));
+#endif
+
+    return WICED_SUCCESS;
+}
+
+/*
+ Function name:
+ adc_app_dump_burst
+
+ Function Description:
+ @brief    This function displays samples of the last burst capture. The
+           time of each sample is interpolated between the start and the
+           end of the burst.
+
+ @param first    Index of the first sample to display
+ @param count    Samples to display
+
+ @return void doesnt return anything
+ */
+static void adc_app_dump_burst(UINT16 first, UINT16 count)
+{
+    UINT32 elapsed = burst_end_us - burst_start_us;
+
+    if (first >= burst_count)
+    {
+        return;
+    }
+    if (count > burst_count - first)
+    {
+        count = burst_count - first;
+    }
+
+    WICED_BT_TRACE("ADC Channel: %s burst samples %d..%d\r\n",
+                   adc_app_channels[burst_ch_idx].name, first, first + count - 1);
+    for (UINT16 n = first; n < first + count; n++)
+    {
+        UINT32 timestamp = burst_start_us +
+                           (UINT32)(((UINT64)elapsed * n) / burst_count);
+
+#if DEVICE_SUPPORTS_FULL_ADC_API
+        WICED_BT_TRACE("  %u\t: %d (%d mV)\r\n", timestamp, burst_buf[n],
+                       adc_app_raw_to_mvolt(burst_ch_idx, burst_buf[n]));
+#else
+        WICED_BT_TRACE("  %u\t: %d\r\n", timestamp, burst_buf[n]);
+#endif
+    }
+}
+#endif
+
+/*
+ Function name:
+ adc_app_dump_histograms
+
+ Function Description:
+ @brief    This function displays the raw value histogram of every channel
+           that has one. Counts accumulate from start-up.
+
+ @return void doesnt return anything
+ */
+void adc_app_dump_histograms(void)
+{
+    for (UINT8 ch_idx = 0; ch_idx < ADC_APP_NUM_CHANNELS; ch_idx++)
+    {
+        adc_hist_t *p_hist = &adc_app_state[ch_idx].hist;
+
+        if (p_hist->num_buckets == 0)
+        {
+            continue;
+        }
+
+        WICED_BT_TRACE("ADC Channel: %s histogram of %d samples\r\n",
+                       adc_app_channels[ch_idx].name, p_hist->total);
+        for (UINT8 i = 0; i < p_hist->num_buckets; i++)
+        {
+            WICED_BT_TRACE("  >= %d\t: %d\r\n",
+                           adc_hist_bucket_lo(p_hist, i), p_hist->counts[i]);
+        }
+    }
+}
+
+/*
+ Function name:
+ adc_app_dump_timing
+
+ Function Description:
+ @brief    This function displays how late the sampling scans, the
+           report timer callbacks, the reports and the drains woke up, how
+           long they ran and the deadlines they missed, and the skew of
+           every scan group. Counts accumulate from start-up.
+
+ @return void doesnt return anything
+ */
+void adc_app_dump_timing(void)
+{
+    adc_dump_jitter("Sampling timer", &sample_timing);
+    adc_dump_jitter("Report timer", &report_timing);
+    for (UINT8 g = 0; g < APP_MAX_GROUPS; g++)
+    {
+        const adc_app_group_t *p_group = &adc_app_groups[g];
+
+        if (p_group->scans == 0)
+        {
+            continue;
+        }
+        WICED_BT_TRACE("Group %d skew(in us) last/mean/max: %d/%d/%d\r\n",
+                       g + 1, p_group->skew_us,
+                       (UINT32)(p_group->skew_sum_us / p_group->scans),
+                       p_group->skew_max_us);
+    }
+#if APP_USE_WORKER_THREAD
+    if (report_queue != NULL)
+    {
+        adc_dump_jitter("Report worker", &deferred_timing);
+        WICED_BT_TRACE("Report requests skipped: %d\r\n", report_skips);
+    }
+#else
+    adc_dump_jitter("Report event", &deferred_timing);
+    WICED_BT_TRACE("Report requests skipped: %d\r\n", report_skips);
+#endif
+    adc_dump_jitter("Drain", &drain_timing);
+    WICED_BT_TRACE("Drains: %d scans coalesced: %d\r\n",
+                   drain_events, drain_coalesced);
+#if APP_USE_WORKER_THREAD
+    if (report_queue == NULL)
+#endif
+    {
+        WICED_BT_TRACE("Drains and reports run in the sampling thread, "
+                       "scans wait up to their max duration\r\n");
+    }
+}
+
+/*
+ Function name:
+ adc_dump_jitter
+
+ Function Description:
+ @brief    This function displays the timing histograms of one timer.
+
+ @param name     Name printed in the header
+ @param p_jit    Timing statistics
+
+ @return void doesnt return anything
+ */
+static void adc_dump_jitter(const char *name, const adc_jitter_t *p_jit)
+{
+    WICED_BT_TRACE("%s timing of %d runs, missed: %d overruns: %d\r\n",
+                   name, p_jit->scans, p_jit->missed, p_jit->overruns);
+    WICED_BT_TRACE("  Max lateness(in us): %d max duration(in us): %d\r\n",
+                   p_jit->lateness.max_us, p_jit->duration.max_us);
+    WICED_BT_TRACE("  us\t: late\tduration\r\n");
+    for (UINT8 i = 0; i < ADC_JITTER_BUCKETS; i++)
+    {
+        if ((p_jit->lateness.counts[i] | p_jit->duration.counts[i]) == 0)
+        {
+            continue;
+        }
+        WICED_BT_TRACE("  >= %d\t: %d\t%d\r\n", adc_jitter_bucket_lo(i),
+                       p_jit->lateness.counts[i], p_jit->duration.counts[i]);
+    }
+}
+
+/*
+ Function name:
+ adc_timestamp_us
+
+ Function Description:
+ @brief    Returns the free running microsecond time used to stamp samples.
+
+ @return lower 32 bits of the system time in microseconds
+ */
+static UINT32 adc_timestamp_us(void)
+{
+    return (UINT32)clock_SystemTimeMicroseconds64();
+}
+
+/*
+ Function name:
+ adc_app_set_averaging
+
+ Function Description:
+ @brief    This function sets the number of samples averaged for every
+           reading of the particular channel that is passed. It may be
+           called at any time, the next scan picks up the new count.
+
+ @param ch_idx         Index of the channel in adc_app_channels
+ @param avg_samples    Samples to average, clamped to 1..AVG_NUM_OF_SAMPLES_MAX
+
+ @return acquisition time of one reading of the channel in microseconds,
+         0 for a virtual channel, which is not averaged
+ */
+UINT32 adc_app_set_averaging(UINT8 ch_idx, UINT8 avg_samples)
+{
+    if ((ch_idx >= ADC_APP_NUM_CHANNELS) || ADC_APP_IS_VIRTUAL(ch_idx))
+    {
+        return 0;
+    }
+
+    if (avg_samples == 0)
+    {
+        avg_samples = 1;
+    }
+    if (avg_samples > AVG_NUM_OF_SAMPLES_MAX)
+    {
+        avg_samples = AVG_NUM_OF_SAMPLES_MAX;
+    }
+
+    adc_app_state[ch_idx].avg_samples = avg_samples;
+
+    return avg_samples * adc_app_conversions(ch_idx) * ADC_CONVERSION_TIME_US;
+}
+
+/*
+ Function name:
+ adc_app_scan_time_us
+
+ Function Description:
+ @brief    This function estimates the time taken by one scan of all
+           channels with their current averaging counts.
+
+ @return acquisition time of one scan in microseconds
+ */
+static UINT32 adc_app_scan_time_us(void)
+{
+    UINT32 scan_time = 0;
+
+    for (UINT8 i = 0; i < ADC_APP_NUM_CHANNELS; i++)
+    {
+        scan_time += adc_app_state[i].avg_samples * adc_app_conversions(i) *
+                     ADC_CONVERSION_TIME_US;
+    }
+
+    return scan_time;
+}
+
+/*
+ Function name:
+ adc_app_conversions
+
+ Function Description:
+ @brief    This function returns the ADC conversions behind one averaged
+           sample of the particular channel that is passed.
+
+ @param ch_idx    Index of the channel in adc_app_channels
+
+ @return 2 for a differential pair, 0 for a virtual channel, 1 otherwise
+ */
+static UINT8 adc_app_conversions(UINT8 ch_idx)
+{
+    if (ADC_APP_IS_VIRTUAL(ch_idx))
+    {
+        return 0;
+    }
+    return adc_app_channels[ch_idx].differential ? 2 : 1;
+}
+
+/*
+ Function name:
+ adc_app_saturate
+
+ Function Description:
+ @brief    This function clamps a difference of raw samples to the raw
+           sample range.
+
+ @param val    Difference of raw samples
+
+ @return val saturated to 16 bits
+ */
+static INT16 adc_app_saturate(INT32 val)
+{
+    if (val > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (val < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (INT16)val;
+}
+
+#if DEVICE_SUPPORTS_FULL_ADC_API
+/*
+ Function name:
+ adc_app_raw_to_mvolt
+
+ Function Description:
+ @brief    This function converts a raw value of the particular channel
+           that is passed into millivolts, as a voltage difference for a
+           differential pair. Not for virtual channels, whose values are
+           in the units of their expression.
+
+ @param ch_idx     Index of the channel in adc_app_channels
+ @param raw_val    Raw value of the channel
+
+ @return millivoltage equivalent of the raw value
+ */
+static INT32 adc_app_raw_to_mvolt(UINT8 ch_idx, INT16 raw_val)
+{
+    if (adc_app_channels[ch_idx].differential)
+    {
+        return convert_adc_diff_to_mvolt(raw_val);
+    }
+    return (INT32)convert_adc_raw_to_mvolt(raw_val);
+}
+
+/*
+ Function name:
+ convert_adc_raw_to_mvolt
+
+ Function Description:
+ @brief    This function allows the user to convert a raw sample into
+           its equivalent voltage.
+
+ @param raw_val    Sampled raw value from ADC
+
+ @return millivoltage equivalent of sampled raw value
+ */
+static UINT32 convert_adc_raw_to_mvolt(INT16 raw_val)
+{
+    INT32 mvolt = raw_val;
+    INT32 gnd_reading = wiced_hal_adc_get_ground_offset();
+    INT32 ref_reading = wiced_hal_adc_get_reference_reading();
+    UINT32 ref_mvolts = wiced_hal_adc_get_reference_micro_volts();
+
+    if (mvolt == 0)
+    {
+        return 0;
+    }
+
+    if (mvolt < gnd_reading)
+    {
+        mvolt = gnd_reading;
+    }
+
+    mvolt -= gnd_reading;
+    mvolt *= ref_mvolts;
+    mvolt += ((ref_reading - gnd_reading) >> 1);           /* For rounding up */
+    mvolt /= (ref_reading - gnd_reading);
 
     return (uint32_t)mvolt;
 }
+/*
+ Function name:
+ convert_adc_diff_to_mvolt
+
+ Function Description:
+ @brief    This function converts the difference of two raw samples into
+           a voltage difference. The ground offset is common to both
+           samples and cancels, only the gain is applied.
+
+ @param diff_val    Difference of two raw samples
+
+ @return millivoltage equivalent of the difference
+ */
+static INT32 convert_adc_diff_to_mvolt(INT16 diff_val)
+{
+    INT32 gnd_reading = wiced_hal_adc_get_ground_offset();
+    INT32 ref_reading = wiced_hal_adc_get_reference_reading();
+    UINT32 ref_mvolts = wiced_hal_adc_get_reference_micro_volts();
+    INT32 span = ref_reading - gnd_reading;
+    INT32 mvolt = diff_val * (INT32)ref_mvolts;
+
+    /* Round half away from zero */
+    mvolt += (mvolt < 0) ? -(span >> 1) : (span >> 1);
+
+    return mvolt / span;
+}
 #endif
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  bench_biquad.c
+ *
+ * @brief
+ *  Host benchmark of the biquad cascade (adc_biquad.c): time per sample
+ *  of the Butterworth presets in both direct forms, filtering blocks of
+ *  ADC_BLOCK_SIZE samples in place the way the application does.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "adc_block.h"
+#include "adc_biquad.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Samples filtered per configuration */
+#define BENCH_SAMPLES                 (1UL << 22)
+
+/* Test signal length, a whole number of blocks */
+#define BENCH_SIGNAL_LEN              (64 * ADC_BLOCK_SIZE)
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ bench_one
+
+ Function Description:
+ @brief    Times BENCH_SAMPLES samples through one cascade and prints the
+           time and time stamp counter ticks per sample.
+
+ @param name        Preset name
+ @param p_signal    Test signal of BENCH_SIGNAL_LEN samples
+ @param p_coef      Coefficients of the cascade
+ @param sections    Sections in p_coef
+ @param form        Direct form
+
+ @return void
+ */
+static void bench_one(const char *name, const int16_t *p_signal,
+                      const adc_biquad_coef_t *p_coef, uint8_t sections,
+                      adc_biquad_form_t form)
+{
+    static int16_t buf[ADC_BLOCK_SIZE];
+    adc_biquad_t bq;
+    uint64_t start;
+    uint64_t start_cycles;
+    uint64_t elapsed;
+    uint64_t cycles;
+    int32_t checksum = 0;
+
+    adc_biquad_init(&bq, p_coef, sections, form);
+
+    start_cycles = bench_cycles();
+    start = bench_now_ns();
+    for (uint32_t n = 0; n < BENCH_SAMPLES; n += ADC_BLOCK_SIZE)
+    {
+        memcpy(buf, &p_signal[n % BENCH_SIGNAL_LEN], sizeof(buf));
+        adc_biquad_process(&bq, buf, ADC_BLOCK_SIZE);
+        checksum += buf[0];
+    }
+    elapsed = bench_now_ns() - start;
+    cycles = bench_cycles() - start_cycles;
+
+    printf("  %-12s %-4s %8u %10.2f %13.2f  %d\n", name,
+           (form == ADC_BIQUAD_DF1) ? "DF1" : "TDF2", sections,
+           (double)elapsed / (double)BENCH_SAMPLES,
+           (double)cycles / (double)BENCH_SAMPLES, (int)checksum);
+}
+
+int main(void)
+{
+    static int16_t signal[BENCH_SIGNAL_LEN];
+    uint32_t seed = BENCH_SEED;
+
+    for (uint32_t n = 0; n < BENCH_SIGNAL_LEN; n++)
+    {
+        signal[n] = (int16_t)(bench_rand15(&seed) >> 4);
+    }
+
+    printf("bench_biquad: %lu samples per configuration, blocks of %u\n",
+           BENCH_SAMPLES, (unsigned)ADC_BLOCK_SIZE);
+    printf("  preset       form sections  ns/sample  ticks/sample  checksum\n");
+    for (int form = ADC_BIQUAD_DF1; form <= ADC_BIQUAD_TDF2; form++)
+    {
+        bench_one("lp2_fs10", signal, adc_biquad_lp2_fs10, 1, (adc_biquad_form_t)form);
+        bench_one("lp2_fs20", signal, adc_biquad_lp2_fs20, 1, (adc_biquad_form_t)form);
+        bench_one("lp4_fs20", signal, adc_biquad_lp4_fs20, 2, (adc_biquad_form_t)form);
+    }
+
+    return 0;
+}
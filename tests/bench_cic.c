@@ -0,0 +1,209 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  bench_cic.c
+ *
+ * @brief
+ *  Host throughput benchmark of the CIC decimator (adc_cic.c) for every
+ *  supported order and a range of decimation ratios, processing blocks of
+ *  ADC_BLOCK_SIZE samples the way the application does. Every
+ *  configuration must emit one output per ratio inputs, and a DC input
+ *  must come out unchanged, including ratios above 256.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include "bench.h"
+#include "adc_block.h"
+#include "adc_cic.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Samples filtered per configuration */
+#define BENCH_SAMPLES                 (1UL << 22)
+
+/* Test signal length, a whole number of blocks */
+#define BENCH_SIGNAL_LEN              (64 * ADC_BLOCK_SIZE)
+
+/* Level of the DC check */
+#define BENCH_DC_LEVEL                1000
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ bench_one
+
+ Function Description:
+ @brief    Times BENCH_SAMPLES samples through one CIC configuration and
+           prints the throughput.
+
+ @param p_signal      Test signal of BENCH_SIGNAL_LEN samples
+ @param order         CIC stages
+ @param ratio_shift   log2 of the decimation ratio
+ @param compensate    Apply droop compensation
+
+ @return 1 if the number of outputs is right, 0 otherwise
+ */
+static int bench_one(const int16_t *p_signal, uint8_t order,
+                      uint8_t ratio_shift, uint8_t compensate)
+{
+    static int16_t out[ADC_BLOCK_SIZE];
+    adc_cic_t cic;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t outputs = 0;
+
+    if (!adc_cic_init(&cic, order, ratio_shift, compensate))
+    {
+        printf("FAIL: order %u ratio_shift %u rejected\n", order, ratio_shift);
+        return 0;
+    }
+
+    start = bench_now_ns();
+    for (uint32_t n = 0; n < BENCH_SAMPLES; n += ADC_BLOCK_SIZE)
+    {
+        outputs += adc_cic_process(&cic, &p_signal[n % BENCH_SIGNAL_LEN], out,
+                                   ADC_BLOCK_SIZE);
+    }
+    elapsed = bench_now_ns() - start;
+
+    printf("  %5u %5u %4u %11.2f %10.2f  %u\n",
+           order, 1u << ratio_shift, compensate,
+           (double)BENCH_SAMPLES * 1000.0 / (double)elapsed,
+           (double)elapsed / (double)BENCH_SAMPLES, outputs);
+
+    if (outputs != (BENCH_SAMPLES >> ratio_shift))
+    {
+        printf("FAIL: %u outputs, expected %lu\n", outputs,
+               BENCH_SAMPLES >> ratio_shift);
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+ Function name:
+ check_dc
+
+ Function Description:
+ @brief    Feeds BENCH_DC_LEVEL to one configuration for order + 2
+           decimation periods; once the filter has settled every output
+           must equal the input.
+
+ @param order          CIC stages
+ @param ratio_shift    log2 of the decimation ratio
+
+ @return 1 if the DC level is kept, 0 otherwise
+ */
+static int check_dc(uint8_t order, uint8_t ratio_shift)
+{
+    static int16_t in[ADC_BLOCK_SIZE];
+    int16_t out[ADC_BLOCK_SIZE];
+    adc_cic_t cic;
+    uint32_t inputs = (uint32_t)(order + 2) << ratio_shift;
+    uint32_t outputs = 0;
+    int16_t last = 0;
+
+    for (uint16_t n = 0; n < ADC_BLOCK_SIZE; n++)
+    {
+        in[n] = BENCH_DC_LEVEL;
+    }
+
+    adc_cic_init(&cic, order, ratio_shift, 0);
+    for (uint32_t n = 0; n < inputs; n += ADC_BLOCK_SIZE)
+    {
+        uint16_t count = adc_cic_process(&cic, in, out, ADC_BLOCK_SIZE);
+
+        if (count != 0)
+        {
+            last = out[count - 1];
+        }
+        outputs += count;
+    }
+
+    printf("  DC check order %u ratio %5u: %u outputs, last %d\n",
+           order, 1u << ratio_shift, outputs, last);
+
+    return (outputs == (uint32_t)order + 2) && (last == BENCH_DC_LEVEL);
+}
+
+int main(void)
+{
+    static int16_t signal[BENCH_SIGNAL_LEN];
+    uint32_t seed = BENCH_SEED;
+    int ok = 1;
+
+    for (uint32_t n = 0; n < BENCH_SIGNAL_LEN; n++)
+    {
+        signal[n] = (int16_t)(bench_rand15(&seed) >> 4);
+    }
+
+    printf("bench_cic: %lu samples per configuration, blocks of %u\n",
+           BENCH_SAMPLES, (unsigned)ADC_BLOCK_SIZE);
+    printf("  order ratio comp  Msamples/s  ns/sample  outputs\n");
+    for (uint8_t order = 1; order <= ADC_CIC_MAX_ORDER; order++)
+    {
+        for (uint8_t ratio_shift = 1; ratio_shift <= 4; ratio_shift++)
+        {
+            ok &= bench_one(signal, order, ratio_shift, 0);
+        }
+    }
+    ok &= bench_one(signal, 3, 3, 1);
+
+    /* Ratios above 256, only a first order filter has the headroom */
+    ok &= bench_one(signal, 1, 9, 0);
+    ok &= bench_one(signal, 1, 12, 0);
+    ok &= bench_one(signal, 1, 16, 0);
+
+    ok &= check_dc(1, 9);
+    ok &= check_dc(1, 12);
+    ok &= check_dc(1, 16);
+    ok &= check_dc(2, 8);
+    ok &= check_dc(4, 4);
+
+    if (!ok)
+    {
+        printf("FAIL\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  bench_fft.c
+ *
+ * @brief
+ *  Host benchmark of the fixed-point FFT (adc_fft.c) for N = 64 to 1024,
+ *  built with ADC_FFT_MAX_POINTS = 1024. Every size is also checked: a
+ *  full-scale tone must come out in its own bin.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "adc_fft.h"
+#include "adc_trig.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define BENCH_MIN_POINTS              64
+#define BENCH_MAX_POINTS              1024
+
+/* Points transformed per size */
+#define BENCH_POINTS_TOTAL            (1UL << 22)
+
+/* Bin of the check tone */
+#define BENCH_TONE_BIN                5
+
+#if ADC_FFT_MAX_POINTS < BENCH_MAX_POINTS
+#error "Build with -DADC_FFT_MAX_POINTS=1024"
+#endif
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ bench_fill_tone
+
+ Function Description:
+ @brief    Fills n points with a half-scale cosine in bin BENCH_TONE_BIN.
+
+ @param p_re    Real parts
+ @param p_im    Imaginary parts, cleared
+ @param n       Number of points
+
+ @return void
+ */
+static void bench_fill_tone(int16_t *p_re, int16_t *p_im, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++)
+    {
+        uint16_t phase = (uint16_t)(((uint32_t)65536 * BENCH_TONE_BIN * i) / n);
+
+        p_re[i] = (int16_t)(adc_cos_q15(phase) >> 1);
+        p_im[i] = 0;
+    }
+}
+
+int main(void)
+{
+    static int16_t re[BENCH_MAX_POINTS];
+    static int16_t im[BENCH_MAX_POINTS];
+    static uint16_t mag[BENCH_MAX_POINTS / 2];
+    int failed = 0;
+
+    adc_fft_init();
+
+    printf("bench_fft: %lu points per size\n", BENCH_POINTS_TOTAL);
+    printf("  points  us/transform  ns/point  ticks/transform  peak bin (mag)\n");
+    for (uint16_t n = BENCH_MIN_POINTS; n <= BENCH_MAX_POINTS; n <<= 1)
+    {
+        uint32_t runs = BENCH_POINTS_TOTAL / n;
+        uint64_t elapsed = 0;
+        uint64_t cycles = 0;
+        uint16_t peak = 0;
+
+        /* Refilled every run, only the transform is timed */
+        for (uint32_t r = 0; r < runs; r++)
+        {
+            uint64_t start;
+            uint64_t start_cycles;
+
+            bench_fill_tone(re, im, n);
+            start_cycles = bench_cycles();
+            start = bench_now_ns();
+            adc_fft_q15(re, im, n);
+            elapsed += bench_now_ns() - start;
+            cycles += bench_cycles() - start_cycles;
+        }
+
+        adc_fft_magnitude(re, im, n, mag);
+        for (uint16_t k = 1; k < n / 2; k++)
+        {
+            if (mag[k] > mag[peak])
+            {
+                peak = k;
+            }
+        }
+
+        printf("  %6u %13.2f %9.2f %16.0f  %8u (%u)\n", n,
+               (double)elapsed / 1000.0 / (double)runs,
+               (double)elapsed / (double)BENCH_POINTS_TOTAL,
+               (double)cycles / (double)runs, peak, mag[peak]);
+
+        if (peak != BENCH_TONE_BIN)
+        {
+            printf("FAIL: tone found in bin %u\n", peak);
+            failed = 1;
+        }
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  bench_median.c
+ *
+ * @brief
+ *  Host benchmark of the streaming median filter and Hampel rejector
+ *  (adc_median.c): time per sample against the window size, filtering
+ *  blocks of ADC_BLOCK_SIZE samples in place the way the application
+ *  does, with and without the Hampel rejector.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "adc_block.h"
+#include "adc_median.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Samples filtered per configuration */
+#define BENCH_SAMPLES                 (1UL << 21)
+
+/* Test signal length, a whole number of blocks */
+#define BENCH_SIGNAL_LEN              (64 * ADC_BLOCK_SIZE)
+
+/* Hampel threshold of the rejector runs, 3 MADs in Q8 */
+#define BENCH_HAMPEL_K_Q8             (3 << 8)
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ bench_one
+
+ Function Description:
+ @brief    Times BENCH_SAMPLES samples through one filter configuration
+           and prints the time per sample.
+
+ @param p_signal       Test signal of BENCH_SIGNAL_LEN samples
+ @param window         Odd window length
+ @param hampel_k_q8    Hampel threshold, 0 for a plain median
+
+ @return time per sample in nanoseconds
+ */
+static double bench_one(const int16_t *p_signal, uint8_t window,
+                        uint16_t hampel_k_q8)
+{
+    static int16_t buf[ADC_BLOCK_SIZE];
+    adc_median_t med;
+    uint64_t start;
+    int32_t checksum = 0;
+
+    adc_median_init(&med, window, hampel_k_q8);
+
+    start = bench_now_ns();
+    for (uint32_t n = 0; n < BENCH_SAMPLES; n += ADC_BLOCK_SIZE)
+    {
+        memcpy(buf, &p_signal[n % BENCH_SIGNAL_LEN], sizeof(buf));
+        adc_median_process(&med, buf, ADC_BLOCK_SIZE);
+        checksum += buf[0];
+    }
+
+    /* Keeps the filter output live */
+    if (checksum == 0x7FFFFFFF)
+    {
+        printf("\n");
+    }
+
+    return (double)(bench_now_ns() - start) / (double)BENCH_SAMPLES;
+}
+
+int main(void)
+{
+    static int16_t signal[BENCH_SIGNAL_LEN];
+    uint32_t seed = BENCH_SEED;
+
+    /* Noise around a level, with a spike now and then */
+    for (uint32_t n = 0; n < BENCH_SIGNAL_LEN; n++)
+    {
+        signal[n] = (int16_t)(1000 + (bench_rand15(&seed) >> 10));
+        if ((bench_rand15(&seed) & 0x3F) == 0)
+        {
+            signal[n] += 500;
+        }
+    }
+
+    printf("bench_median: %lu samples per configuration, blocks of %u\n",
+           BENCH_SAMPLES, (unsigned)ADC_BLOCK_SIZE);
+    printf("  window  median ns/sample  hampel ns/sample\n");
+    for (uint8_t window = ADC_MEDIAN_MIN_WINDOW; window <= ADC_MEDIAN_MAX_WINDOW;
+         window += 2)
+    {
+        double median_ns = bench_one(signal, window, 0);
+        double hampel_ns = bench_one(signal, window, BENCH_HAMPEL_K_Q8);
+
+        printf("  %6u %17.2f %17.2f\n", window, median_ns, hampel_ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  bench_rms.c
+ *
+ * @brief
+ *  Host benchmark of the windowed RMS, peak and crest factor detector
+ *  (adc_rms.c). The cost per sample is measured over millions of samples,
+ *  so timer resolution does not matter, for several window lengths. A
+ *  sine of known amplitude checks the result first.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "adc_rms.h"
+#include "adc_trig.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Samples timed per window length */
+#define BENCH_SAMPLES                 (1UL << 24)
+
+/* Test signal length, a power of two */
+#define BENCH_SIGNAL_LEN              4096
+
+/* Check sine: amplitude 1000 around 2000, 64 samples per period */
+#define BENCH_CHECK_AMPLITUDE         1000
+#define BENCH_CHECK_DC                2000
+#define BENCH_CHECK_PERIOD            64
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ bench_check
+
+ Function Description:
+ @brief    Runs one window of a sine through the detector and compares
+           the summary with the expected RMS (amplitude / sqrt 2).
+
+ @return 1 if the summary is as expected, 0 otherwise
+ */
+static int bench_check(void)
+{
+    adc_rms_t rms;
+    adc_rms_summary_t summary;
+    int done = 0;
+
+    adc_rms_init(&rms, 16 * BENCH_CHECK_PERIOD);
+    for (uint16_t i = 0; !done; i++)
+    {
+        uint16_t phase = (uint16_t)((65536 / BENCH_CHECK_PERIOD) * i);
+        int16_t x = (int16_t)(BENCH_CHECK_DC +
+                              ((BENCH_CHECK_AMPLITUDE * adc_sin_q15(phase)) >> 15));
+
+        done = adc_rms_add(&rms, x, &summary);
+    }
+
+    printf("  check: rms %u.%02u (expected 707.1), peak %u, mean %d\n",
+           summary.rms_q8 >> ADC_RMS_FRAC_BITS,
+           ((summary.rms_q8 & 0xFF) * 100) >> ADC_RMS_FRAC_BITS,
+           summary.peak, summary.mean);
+
+    return ((summary.rms_q8 >> ADC_RMS_FRAC_BITS) >= 705) &&
+           ((summary.rms_q8 >> ADC_RMS_FRAC_BITS) <= 709) &&
+           (summary.mean == BENCH_CHECK_DC);
+}
+
+int main(void)
+{
+    static const uint16_t windows[] = { 16, 50, 256, 4096 };
+    static int16_t signal[BENCH_SIGNAL_LEN];
+    uint32_t seed = BENCH_SEED;
+
+    printf("bench_rms: %lu samples per window length\n", BENCH_SAMPLES);
+    if (!bench_check())
+    {
+        printf("FAIL: unexpected RMS\n");
+        return EXIT_FAILURE;
+    }
+
+    for (uint32_t n = 0; n < BENCH_SIGNAL_LEN; n++)
+    {
+        signal[n] = (int16_t)(bench_rand15(&seed) >> 3);
+    }
+
+    printf("  window  ns/sample  ticks/sample  windows\n");
+    for (uint8_t w = 0; w < sizeof(windows) / sizeof(windows[0]); w++)
+    {
+        adc_rms_t rms;
+        adc_rms_summary_t summary;
+        uint32_t summaries = 0;
+        uint64_t start;
+        uint64_t start_cycles;
+        uint64_t elapsed;
+        uint64_t cycles;
+
+        adc_rms_init(&rms, windows[w]);
+
+        start_cycles = bench_cycles();
+        start = bench_now_ns();
+        for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+        {
+            summaries += adc_rms_add(&rms, signal[n & (BENCH_SIGNAL_LEN - 1)], &summary);
+        }
+        elapsed = bench_now_ns() - start;
+        cycles = bench_cycles() - start_cycles;
+
+        printf("  %6u %10.2f %13.2f  %u\n", windows[w],
+               (double)elapsed / (double)BENCH_SAMPLES,
+               (double)cycles / (double)BENCH_SAMPLES, summaries);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  capture_rearm.c
+ *
+ * @brief
+ *  Host test of the re-arm of the pre-trigger capture (adc_capture.c).
+ *  A level trigger is held, so the capture fires again on the first
+ *  sample after each re-arm, and every window must still carry the full
+ *  ADC_CAPTURE_PRE_SAMPLES history right before its trigger. The second
+ *  pass leaves the window frozen for a few samples before re-arming, and
+ *  checks that those samples do not disturb the frozen window.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "adc_capture.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define TEST_PERIOD_US                100u
+#define TEST_LEVEL                    1000
+#define TEST_POST                     4
+
+/* Sample n is below the level before the first trigger, above it after */
+#define TEST_FIRST_TRIGGER            (2 * ADC_CAPTURE_PRE_SAMPLES)
+#define TEST_VALUE(n)                 ((int16_t)(((n) < TEST_FIRST_TRIGGER) ? (n) : TEST_LEVEL + (n)))
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ test_window
+
+ Function Description:
+ @brief    Checks that the frozen window holds, in time order, the
+           ADC_CAPTURE_PRE_SAMPLES samples before trigger sample n and
+           the TEST_POST samples from n on.
+
+ @param p_cap    Capture with a frozen window
+ @param n        Index of the expected trigger sample
+
+ @return 1 if the window is right, 0 otherwise
+ */
+static int test_window(const adc_capture_t *p_cap, uint32_t n)
+{
+    if ((p_cap->state != ADC_CAPTURE_FROZEN) ||
+        (p_cap->pre_count != ADC_CAPTURE_PRE_SAMPLES) ||
+        (p_cap->post_count != TEST_POST))
+    {
+        printf("FAIL: window of trigger %u has %u+%u samples, state %u\n",
+               n, p_cap->pre_count, p_cap->post_count, p_cap->state);
+        return 0;
+    }
+
+    for (uint16_t i = 0; i < ADC_CAPTURE_PRE_SAMPLES + TEST_POST; i++)
+    {
+        uint32_t expected = n - ADC_CAPTURE_PRE_SAMPLES + i;
+        uint32_t timestamp;
+        int16_t raw;
+
+        adc_capture_get(p_cap, i, &timestamp, &raw);
+        if ((timestamp != expected * TEST_PERIOD_US) || (raw != TEST_VALUE(expected)))
+        {
+            printf("FAIL: window of trigger %u, sample %u is %u us: %d, expected %u us: %d\n",
+                   n, i, timestamp, raw, expected * TEST_PERIOD_US, TEST_VALUE(expected));
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ Function name:
+ test_pass
+
+ Function Description:
+ @brief    Runs two back-to-back captures on a held level trigger.
+
+ @param frozen_samples    Samples added to the frozen first window before
+                          it is re-armed
+
+ @return 1 if both windows are right, 0 otherwise
+ */
+static int test_pass(uint32_t frozen_samples)
+{
+    adc_capture_t cap;
+    uint32_t n = 0;
+    uint32_t second;
+
+    adc_capture_init(&cap, ADC_CAPTURE_TRIG_LEVEL, TEST_LEVEL, 0, TEST_POST);
+
+    while (!adc_capture_add(&cap, n * TEST_PERIOD_US, TEST_VALUE(n)))
+    {
+        n++;
+    }
+    n++;
+    if (!test_window(&cap, TEST_FIRST_TRIGGER))
+    {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < frozen_samples; i++, n++)
+    {
+        if (adc_capture_add(&cap, n * TEST_PERIOD_US, TEST_VALUE(n)))
+        {
+            printf("FAIL: frozen window completed again at sample %u\n", n);
+            return 0;
+        }
+    }
+    if (!test_window(&cap, TEST_FIRST_TRIGGER))
+    {
+        return 0;
+    }
+
+    adc_capture_rearm(&cap);
+
+    /* Still above the level, so the next sample triggers again */
+    second = n;
+    while (!adc_capture_add(&cap, n * TEST_PERIOD_US, TEST_VALUE(n)))
+    {
+        n++;
+    }
+
+    return test_window(&cap, second);
+}
+
+int main(void)
+{
+    printf("capture_rearm: %u pre-trigger and %u post-trigger samples\n",
+           ADC_CAPTURE_PRE_SAMPLES, TEST_POST);
+
+    if (!test_pass(0) || !test_pass(5))
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
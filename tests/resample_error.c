@@ -0,0 +1,162 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  resample_error.c
+ *
+ * @brief
+ *  Host test of the interpolation error of the resampler (adc_resample.c).
+ *  A known two-tone signal is sampled every 100 ms with up to 20 ms of
+ *  random timer lateness, resampled onto the 100 ms grid in linear and
+ *  cubic mode, and every grid point is compared with the exact signal at
+ *  that time. The times start just below the 32 bit wrap.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "adc_resample.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define TEST_PERIOD_US                100000u
+#define TEST_JITTER_US                20000u
+#define TEST_SAMPLES                  5000
+#define TEST_START_US                 0xFFF00000u
+#define TEST_PI                       3.14159265358979323846
+
+/* Upper bounds of the RMS error in raw counts, for a 1300 count signal */
+#define TEST_MAX_RMS_LINEAR           8.0
+#define TEST_MAX_RMS_CUBIC            4.0
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/* Two tones of 1000 and 300 counts, t in microseconds since TEST_START_US */
+static double test_signal(uint32_t t_us)
+{
+    double t = (double)t_us;
+
+    return 1000.0 * sin(2.0 * TEST_PI * t / 2.0e6) + 300.0 * sin(2.0 * TEST_PI * t / 0.7e6);
+}
+
+/*
+ Function name:
+ test_mode
+
+ Function Description:
+ @brief    Resamples the jittered signal in one mode and prints the RMS
+           and maximum error of the grid points.
+
+ @param mode    Interpolation mode
+
+ @return RMS error in raw counts, or a negative value if the grid is wrong
+ */
+static double test_mode(adc_resample_mode_t mode)
+{
+    adc_resample_t rs;
+    uint32_t seed = BENCH_SEED;
+    uint32_t tick = TEST_START_US;
+    uint32_t grid = 0;
+    double err2 = 0.0;
+    double err_max = 0.0;
+    uint32_t points = 0;
+
+    adc_resample_init(&rs, mode, TEST_PERIOD_US);
+
+    for (int i = 0; i < TEST_SAMPLES; i++)
+    {
+        uint32_t t_us = tick + (((uint32_t)bench_rand15(&seed) * TEST_JITTER_US) >> 15);
+        int16_t x = (int16_t)lround(test_signal(t_us - TEST_START_US));
+        int16_t out[8];
+        uint16_t count = adc_resample_add(&rs, t_us, x, out, 8);
+
+        for (uint16_t k = 0; k < count; k++)
+        {
+            uint32_t grid_us = rs.next_us - (uint32_t)(count - k) * TEST_PERIOD_US;
+            double err;
+
+            if ((points != 0) && (grid_us != grid))
+            {
+                printf("FAIL: grid point at %u, expected %u\n", grid_us, grid);
+                return -1.0;
+            }
+            grid = grid_us + TEST_PERIOD_US;
+
+            err = out[k] - test_signal(grid_us - TEST_START_US);
+            err2 += err * err;
+            if (fabs(err) > err_max)
+            {
+                err_max = fabs(err);
+            }
+            points++;
+        }
+
+        tick += TEST_PERIOD_US;
+    }
+
+    printf("  %-6s %6u %9.2f %9.2f %7u\n",
+           (mode == ADC_RESAMPLE_LINEAR) ? "linear" : "cubic", points,
+           sqrt(err2 / points), err_max, rs.regrids);
+
+    return sqrt(err2 / points);
+}
+
+int main(void)
+{
+    double rms_linear;
+    double rms_cubic;
+
+    printf("resample_error: %d samples every %u us, up to %u us late\n",
+           TEST_SAMPLES, TEST_PERIOD_US, TEST_JITTER_US);
+    printf("  mode   points  rms(raw)  max(raw) regrids\n");
+    rms_linear = test_mode(ADC_RESAMPLE_LINEAR);
+    rms_cubic = test_mode(ADC_RESAMPLE_CUBIC);
+
+    if ((rms_linear < 0.0) || (rms_cubic < 0.0) ||
+        (rms_linear > TEST_MAX_RMS_LINEAR) || (rms_cubic > TEST_MAX_RMS_CUBIC) ||
+        (rms_cubic >= rms_linear))
+    {
+        printf("FAIL: interpolation error out of bounds\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *  ring_stress.c
+ *
+ * @brief
+ *  Host stress test of the SPSC ring (adc_ring.c). A producer thread
+ *  pushes a numbered sequence while a consumer thread pops concurrently
+ *  and pauses now and then so the ring also runs full. Every popped sample
+ *  must come in order, with a timestamp matching its value, and every
+ *  missing sample must be accounted for in the drop counter.
+ */
+
+/******************************************************************************
+ *                                Includes
+ ******************************************************************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sched.h>
+#include "adc_ring.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Samples pushed by the producer */
+#define STRESS_SAMPLES                2000000UL
+
+/*
+ * Each side yields once every this many samples, so the ring runs both
+ * empty and full
+ */
+#define STRESS_PRODUCER_YIELD         64
+#define STRESS_CONSUMER_YIELD         4096
+
+/******************************************************************************
+ *                                Variables Definitions
+ ******************************************************************************/
+static adc_ring_t ring;
+static volatile int consumer_ready;
+static volatile int producer_done;
+
+/******************************************************************************
+ *                          Function Definitions
+ ******************************************************************************/
+
+/*
+ Function name:
+ producer
+
+ Function Description:
+ @brief    Pushes STRESS_SAMPLES samples, the timestamp carrying the
+           sequence number and the raw value its low 16 bits.
+
+ @param arg    unused
+
+ @return NULL
+ */
+static void *producer(void *arg)
+{
+    (void)arg;
+
+    while (!consumer_ready)
+    {
+        sched_yield();
+    }
+
+    for (uint32_t seq = 0; seq < STRESS_SAMPLES; seq++)
+    {
+        adc_ring_push(&ring, seq, (int16_t)seq);
+        if ((seq % STRESS_PRODUCER_YIELD) == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    __sync_synchronize();
+    producer_done = 1;
+
+    return NULL;
+}
+
+/*
+ Function name:
+ consumer
+
+ Function Description:
+ @brief    Pops until the producer is done and the ring is empty, checking
+           the order and consistency of every sample.
+
+ @param arg    Destination of the number of samples popped
+
+ @return NULL, or a non-NULL pointer on the first error
+ */
+static void *consumer(void *arg)
+{
+    uint32_t *p_popped = arg;
+    uint32_t expected_min = 0;
+    adc_sample_t sample;
+
+    consumer_ready = 1;
+
+    while (1)
+    {
+        int done = producer_done;
+
+        if (!adc_ring_pop(&ring, &sample))
+        {
+            if (done)
+            {
+                /* Samples pushed before done was set are visible by now */
+                if (adc_ring_pop(&ring, &sample) == 0)
+                {
+                    return NULL;
+                }
+            }
+            else
+            {
+                sched_yield();
+                continue;
+            }
+        }
+
+        if (sample.raw != (int16_t)sample.timestamp_us)
+        {
+            printf("FAIL: torn sample %u/%d\n", sample.timestamp_us, sample.raw);
+            return p_popped;
+        }
+        if (sample.timestamp_us < expected_min)
+        {
+            printf("FAIL: sample %u out of order, expected >= %u\n",
+                   sample.timestamp_us, expected_min);
+            return p_popped;
+        }
+        expected_min = sample.timestamp_us + 1;
+
+        if ((++*p_popped % STRESS_CONSUMER_YIELD) == 0)
+        {
+            sched_yield();
+        }
+    }
+}
+
+int main(void)
+{
+    pthread_t prod;
+    pthread_t cons;
+    uint32_t popped = 0;
+    void *p_err;
+
+    adc_ring_init(&ring);
+
+    if ((pthread_create(&cons, NULL, consumer, &popped) != 0) ||
+        (pthread_create(&prod, NULL, producer, NULL) != 0))
+    {
+        printf("FAIL: can not create threads\n");
+        return EXIT_FAILURE;
+    }
+
+    pthread_join(prod, NULL);
+    pthread_join(cons, &p_err);
+    if (p_err != NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf("ring_stress: ring %u, pushed %lu, popped %u, dropped %u, high-watermark %u\n",
+           (unsigned)ADC_RING_SIZE, STRESS_SAMPLES, popped, ring.drops,
+           ring.high_watermark);
+
+    if ((popped + ring.drops != STRESS_SAMPLES) ||
+        (ring.high_watermark > ADC_RING_SIZE))
+    {
+        printf("FAIL: samples not accounted for\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}